@@ -32,8 +32,9 @@
 #define OLED_I2C_BAUDRATE    400000 // Frequência do I2C para o OLED (mais rápida é comum)
 
 // --- Variáveis Globais para o OLED ---
-struct render_area frame_area;
-uint8_t ssd_buffer[ssd1306_buffer_length];
+// O display usa buffer duplo: desenha-se em ssd1306_db_back() e o núcleo 1 envia o quadro publicado.
+// Antes disso, as mensagens de inicialização seguem pelo console, com rolagem por hardware
+struct ssd1306_console console;
 
 
 // --- Protótipos de Funções ---
@@ -66,8 +67,10 @@ void mpu6050_init() {
     int ret = i2c_write_blocking(MPU6050_I2C_PORT, MPU6050_ADDR, buf, 2, false);
     if (ret == PICO_ERROR_GENERIC) {
         printf("Erro ao acordar MPU6050! Verifique conexoes e endereco I2C.\n");
+        ssd1306_console_print(&console, "MPU6050 Erro!");
     } else {
         printf("MPU6050 acordado e inicializado com sucesso.\n");
+        ssd1306_console_print(&console, "MPU6050 OK");
     }
     sleep_ms(100);
 }
@@ -117,12 +120,11 @@ void init_oled() {
     gpio_pull_up(OLED_SCL_PIN);
 
     ssd1306_init();
-    frame_area.start_column = 0;
-    frame_area.end_column = ssd1306_width - 1;
-    frame_area.start_page = 0;
-    frame_area.end_page = ssd1306_n_pages - 1;
-    calculate_render_area_buffer_length(&frame_area);
-    memset(ssd_buffer, 0, ssd1306_buffer_length);
+    ssd1306_db_init();
+
+    // Enquanto o núcleo 1 não é iniciado, o console escreve direto do buffer de trás
+    ssd1306_console_init(&console, ssd1306_db_back());
+    ssd1306_console_print(&console, "OLED OK");
 
     sleep_ms(100);
     printf("Display OLED inicializado no I2C1.\n");
@@ -130,14 +132,12 @@ void init_oled() {
 
 // Limpa o buffer do display, mas não o renderiza na tela para otimização
 void clear_oled_display() {
-    memset(ssd_buffer, 0, ssd1306_buffer_length);
+    ssd1306_clear(ssd1306_db_back());
 }
 
 // Desenha uma mensagem no buffer do OLED em uma linha específica
 void display_message_oled(const char *message, int line) {
-    // A função ssd1306_draw_string espera um char *, então fazemos um cast para remover o 'const'
-    // (idealmente, o protótipo da biblioteca ssd1306.h seria atualizado para const char*)
-    ssd1306_draw_string(ssd_buffer, 5, line * 8, (char *)message); 
+    ssd1306_draw_string(ssd1306_db_back(), 5, line * 8, message);
 }
 
 
@@ -154,37 +154,46 @@ int main() {
     init_oled();      
     mpu6050_init();   // Inicializa o MPU6050 (acelerômetro/giroscópio)
 
+    // Os 2 segundos de mensagem de início são divididos: metade para ler o console (ex.: "MPU6050 Erro!"),
+    // metade para o "Pronto!", sem alongar a inicialização
+    sleep_ms(1000);
+
+    // Encerra o console e passa o display ao buffer duplo, enviado pelo núcleo 1
+    ssd1306_console_end(&console);
+    ssd1306_db_launch_core1();
+
     // --- Mensagem de Início no OLED ---
     clear_oled_display();
     display_message_oled("MPU6050", 0);
     display_message_oled("Pronto!", 2);
-    render_on_display(ssd_buffer, &frame_area); // Exibe a mensagem na tela
-    sleep_ms(2000); // Exibe a mensagem por 2 segundos
+    ssd1306_db_publish(); // Publica a mensagem para o núcleo 1 exibir
+    sleep_ms(1000); // Exibe a mensagem pelo restante dos 2 segundos
     clear_oled_display(); // Limpa para a primeira leitura
-    char accelX_str[32];
-    char accelY_str[32];
-    char accelZ_str[32];
-    char gyroX_str[32];
-    char gyroY_str[32];
-    char gyroZ_str[32];
+
+    // Campos das leituras: só os caracteres que mudam são redesenhados
+    struct ssd1306_text_field accel_fields[3];
+    struct ssd1306_text_field gyro_fields[3];
+    for (int i = 0; i < 3; i++) {
+        ssd1306_text_field_init(&accel_fields[i], 5, i * 8, 15);
+        ssd1306_text_field_init(&gyro_fields[i], 5, (i + 5) * 8, 15);
+    }
     int16_t accel_data[3]; // Armazena os dados brutos do acelerômetro (X, Y, Z)
     int16_t gyro_data[3];  // Armazena os dados brutos do giroscópio (X, Y, Z)
     // --- Loop Principal do Programa ---
     while (true) {
         mpu6050_read_raw_data(accel_data, gyro_data);
-        snprintf(accelX_str, sizeof(accelX_str), "Accel X:%d", accel_data[0]);
-        snprintf(accelY_str, sizeof(accelY_str), "Accel Y:%d", accel_data[1]);
-        snprintf(accelZ_str, sizeof(accelZ_str), "Accel Z:%d", accel_data[2]);
-        display_message_oled(accelX_str, 0);
-        display_message_oled(accelY_str, 1);
-        display_message_oled(accelZ_str, 2);
-        snprintf(gyroX_str, sizeof(gyroX_str), "Gyro  X:%d", gyro_data[0]);
-        snprintf(gyroY_str, sizeof(gyroY_str), "Gyro  Y:%d", gyro_data[1]);
-        snprintf(gyroZ_str, sizeof(gyroZ_str), "Gyro  Z:%d", gyro_data[2]);
-        display_message_oled(gyroX_str, 5);
-        display_message_oled(gyroY_str, 6);
-        display_message_oled(gyroZ_str, 7);
-        render_on_display(ssd_buffer, &frame_area);
+        bool changed = false;
+        uint8_t *ssd = ssd1306_db_back();
+        changed |= ssd1306_text_field_printf(ssd, &accel_fields[0], "Accel X:%d", accel_data[0]);
+        changed |= ssd1306_text_field_printf(ssd, &accel_fields[1], "Accel Y:%d", accel_data[1]);
+        changed |= ssd1306_text_field_printf(ssd, &accel_fields[2], "Accel Z:%d", accel_data[2]);
+        changed |= ssd1306_text_field_printf(ssd, &gyro_fields[0], "Gyro  X:%d", gyro_data[0]);
+        changed |= ssd1306_text_field_printf(ssd, &gyro_fields[1], "Gyro  Y:%d", gyro_data[1]);
+        changed |= ssd1306_text_field_printf(ssd, &gyro_fields[2], "Gyro  Z:%d", gyro_data[2]);
+        // Publica o quadro apenas se alguma leitura mudou: o núcleo 1 o envia enquanto este laço segue lendo o sensor
+        if (changed) {
+            ssd1306_db_publish();
+        }
         sleep_ms(1000);
 
     }
@@ -8,10 +8,12 @@
 #include "ws2818b.pio.h"
 #include "hardware/gpio.h"
 #include "inc/ssd1306.h"
+#include "inc/httpd.h"
 #include "hardware/i2c.h"
 #include "pico/binary_info.h"
 #include "hardware/clocks.h"
-#include "direction.h"
+#include "compass_assets.h"
+#include "web_assets.h"
 
 const int VRX = 27;          
 const int VRY = 26;         
@@ -22,6 +24,19 @@ const int ADC_CHANNEL_Y = 0;
 #define THRESHOLD 10       
 #define LED_COUNT 25 
 const int LED_PIN = 7;
+#define JOYSTICK_STREAM_HZ 100 // Amostras por segundo enviadas aos clientes do WebSocket /ws (até 100)
+
+// Códigos das direções nas amostras do WebSocket
+enum { dir_centro, dir_norte, dir_nordeste, dir_leste, dir_sudeste, dir_sul, dir_sudoeste, dir_oeste, dir_noroeste };
+
+// Amostra binária de 9 bytes enviada em /ws, little-endian: tempo em ms desde o boot, eixos X e Y (0 a 4095)
+// e código da direção
+struct __attribute__((packed)) joystick_sample {
+    uint32_t time_ms;
+    uint16_t x;
+    uint16_t y;
+    uint8_t direction;
+};
 
 struct pixel_t {
     uint8_t G, R, B;
@@ -36,8 +51,20 @@ uint16_t vry_value = 0;
 uint16_t prev_vrx_value = 0;
 uint16_t prev_vry_value = 0;
 char direction[16] = "Centro"; 
-uint8_t ssd[ssd1306_buffer_length];
-struct render_area frame_area;
+uint8_t direction_code = dir_centro;
+uint32_t status_version = 0; // Incrementado quando monitor_joystick muda o estado acima; é o ETag de /api/status
+
+// Cópia do estado lida pelo servidor (na interrupção do lwIP). monitor_joystick a reescreve inteira com o lwIP
+// travado, e o ETag e o corpo de /api/status saem da mesma cópia
+struct joystick_state {
+    uint32_t version;
+    uint16_t x;
+    uint16_t y;
+    uint8_t direction_code;
+    char direction[16];
+};
+
+static struct joystick_state published_state = { .direction_code = dir_centro, .direction = "Centro" };
 
 void npInit(uint pin) {
     uint offset = pio_add_program(pio0, &ws2818b_program);
@@ -79,93 +106,75 @@ void init_hardware() {
     gpio_pull_up(14);
     gpio_pull_up(15);
     ssd1306_init();
-    
-    frame_area.start_column = 0;
-    frame_area.end_column = ssd1306_width - 1;
-    frame_area.start_page = 0;
-    frame_area.end_page = ssd1306_n_pages - 1;
-    
-    calculate_render_area_buffer_length(&frame_area);
-    
-    memset(ssd, 0, ssd1306_buffer_length);
-    render_on_display(ssd, &frame_area);
+
+    // O display é atualizado pelo núcleo 1: a leitura do joystick não espera pelo i2c
+    ssd1306_db_init();
+    ssd1306_db_launch_core1();
 }
 
-char http_response[1024];
-
-void create_http_response() {
-
-    snprintf(http_response, sizeof(http_response),
-             "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=UTF-8\r\n\r\n"
-             "<!DOCTYPE html>"
-             "<html>"
-             "<head>"
-             "  <meta charset=\"UTF-8\">"
-             "  <title>Monitor do Joystick</title>"
-             "  <meta http-equiv=\"refresh\" content=\"1\">"
-             "  <style>"
-             "    body {"
-             "      font-family: Arial, sans-serif;"
-             "      background-color: #0066cc;"
-             "      margin: 0;"
-             "      padding: 20px;"
-             "      display: flex;"
-             "      flex-direction: column;"
-             "      align-items: center;"
-             "      justify-content: center;"
-             "      min-height: 100vh;"
-             "      color: white;"
-             "    }"
-             "   a {"
-             "     color: white;"
-             "     text-decoration: none;"
-             "    }"
-             "  </style>"
-             "</head>"
-             "<body>"
-             "  <h1>Monitor do Joystick</h1>"
-             "  <p class='update'><a href=\"/update\">Atualizar Estado</a></p>"
-             "  <h2>Posição do Joystick:</h2>"
-             "  <p>Eixo X: %d</p>"
-             "  <p>Eixo Y: %d</p>"
-             "  <p>Direção: %s</p>" 
-             "</body>"
-             "</html>\r\n",
-             vrx_value, vry_value, direction);
+// Estado em JSON: {"x":2048,"y":2048,"direction":"Centro"}
+enum { field_status };
+
+static const struct httpd_chunk status_json_chunks[] = {
+    httpd_field(field_status),
+};
+
+// no-cache: o navegador guarda a resposta e a revalida pelo ETag, recebendo 304 enquanto o estado não muda
+static const struct httpd_template status_json = httpd_template("application/json", "Cache-Control: no-cache\r\n", status_json_chunks);
+
+static int write_status_field(int id, char *buffer, int size, void *arg) {
+    const struct joystick_state *snapshot = arg;
+
+    return snprintf(buffer, size, "{\"x\":%d,\"y\":%d,\"direction\":\"%s\"}", snapshot->x, snapshot->y, snapshot->direction);
 }
 
-static err_t http_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
-    if (p == NULL) {
-        tcp_close(tpcb);
-        return ERR_OK;
+static err_t handle_status(struct httpd_connection *connection, const struct httpd_request *request) {
+    struct joystick_state snapshot = published_state;
+
+    if (httpd_set_version(connection, request, snapshot.version)) {
+        return httpd_send_not_modified(connection, status_json.headers);
     }
-    pbuf_free(p);
-    create_http_response();
+    return httpd_send_template(connection, &status_json, write_status_field, &snapshot);
+}
 
-    tcp_write(tpcb, http_response, strlen(http_response), TCP_WRITE_FLAG_COPY);
+// Métricas do projeto para /metrics, seguidas das do servidor e do lwIP (httpd_write_metrics)
+static int write_metric(int index, char *buffer, int size, void *arg) {
+    switch (index) {
+        case 0: return httpd_format_metric(buffer, size, "joystick_x", "gauge", "Eixo X (0 a 4095)", published_state.x);
+        case 1: return httpd_format_metric(buffer, size, "joystick_y", "gauge", "Eixo Y (0 a 4095)", published_state.y);
+        case 2: return httpd_format_metric(buffer, size, "joystick_direction", "gauge", "Código da direção (0 centro, 1 norte, no sentido horário)", published_state.direction_code);
+        case 3: return httpd_format_metric(buffer, size, "joystick_changes_total", "counter", "Mudanças do estado", published_state.version);
+        case 4: return httpd_format_metric(buffer, size, "joystick_stream_clients", "gauge", "Clientes do WebSocket /ws", httpd_websocket_clients());
+        default: return httpd_write_metrics(index - 5, buffer, size);
+    }
+}
 
-    return ERR_OK;
+// /metrics no formato de exposição em texto do Prometheus, gerado linha a linha no buffer de envio
+static err_t handle_metrics(struct httpd_connection *connection, const struct httpd_request *request) {
+    return httpd_send_stream(connection, "text/plain; version=0.0.4; charset=utf-8", "Cache-Control: no-store\r\n", write_metric, NULL);
 }
 
-static err_t connection_callback(void *arg, struct tcp_pcb *newpcb, err_t err) {
-    tcp_recv(newpcb, http_callback);  
-    return ERR_OK;
+// WebSocket com as amostras do joystick (struct joystick_sample), enviadas por stream_joystick
+static err_t handle_stream(struct httpd_connection *connection, const struct httpd_request *request) {
+    return httpd_begin_websocket(connection, request);
 }
-static void start_http_server(void) {
-    struct tcp_pcb *pcb = tcp_new();
-    if (!pcb) {
-        printf("Erro ao criar PCB\n");
-        return;
-    }
 
-    if (tcp_bind(pcb, IP_ADDR_ANY, 80) != ERR_OK) {
+// A página (web/) é servida pelos arquivos estáticos: recebe as amostras pelo WebSocket /ws e, sem ele, busca
+// /api/status
+static const struct httpd_route routes[] = {
+    {"GET", "/api/status", handle_status},
+    {"GET", "/ws", handle_stream},
+    {"GET", "/metrics", handle_metrics},
+};
+
+static const struct httpd_server server = httpd_server_with_assets(routes, web_assets);
+
+static void start_http_server(void) {
+    if (httpd_start(&server, 80) != ERR_OK) {
         printf("Erro ao ligar o servidor na porta 80\n");
         return;
     }
 
-    pcb = tcp_listen(pcb);  
-    tcp_accept(pcb, connection_callback);  
-
     printf("Servidor HTTP rodando na porta 80...\n");
 }
 
@@ -203,83 +212,136 @@ void joystick_read_axis(uint16_t *x, uint16_t *y) {
     *y = adc_read();
 }
 
-void reset_display(uint8_t *ssd, struct render_area *frame_area) {
-    memset(ssd, 0, ssd1306_buffer_length);
-    render_on_display(ssd, frame_area);
-}
-
-void print_direction(const char *point) {
+// Mostra o ícone da direção (decodificado da flash direto no framebuffer) e o nome ao lado; sem ícone,
+// apenas o nome
+void print_direction(uint8_t code, const char *point, const uint8_t *icon) {
     strcpy(direction, point);
+    direction_code = code;
     printf("%s\n", point);  
-    reset_display(ssd, &frame_area);
-    ssd1306_draw_string(ssd, 32, 16, point);  
-    render_on_display(ssd, &frame_area);
+    uint8_t *ssd = ssd1306_db_back();
+    ssd1306_clear(ssd);
+    if (icon) {
+        ssd1306_draw_rle(ssd, 0, 0, compass_icon_size, compass_icon_size / 8, icon);
+        ssd1306_draw_string(ssd, compass_icon_size, 24, point);
+    }
+    else {
+        ssd1306_draw_string(ssd, 32, 24, point);
+    }
+    ssd1306_db_publish();
 }
 
-void update_direction_leds(int *array) {
+// Acende os LEDs da máscara (bit i aceso para o LED i)
+void update_direction_leds(uint32_t mask) {
     npClear();
 
-    for (int num = 0; num <= 24; num++) {
-        if(array[num] != 0){
+    for (int num = 0; num < LED_COUNT; num++) {
+        if (mask & (1u << num)) {
             npSetLED(num, 0, 0, 50);
         } 
     }
     npWrite();
 }
 
-void monitor_joystick() {
-    uint16_t current_x, current_y;
-    joystick_read_axis(&current_x, &current_y);
-    
+// Atualiza a direção, o display e os LEDs com a leitura já feita pelo laço principal
+void monitor_joystick(uint16_t current_x, uint16_t current_y) {
     if (abs(current_x - prev_vrx_value) > THRESHOLD || abs(current_y - prev_vry_value) > THRESHOLD) {
         vrx_value = current_x;
         vry_value = current_y;
         prev_vrx_value = current_x;
         prev_vry_value = current_y;
+        status_version++;
         printf("X: %d, Y: %d\n", vrx_value, vry_value); 
         // Lógica para detectar os pontos cardeais
         if (vrx_value > 2000 && vry_value > 4000) {
-            print_direction("Norte");
-            update_direction_leds(norte);
+            print_direction(dir_norte, "Norte", icon_norte);
+            update_direction_leds(leds_norte);
         } else if (vrx_value > 2000 && vrx_value < 3000 && vry_value < 100) {
-            print_direction("Sul");
-            update_direction_leds(sul);
+            print_direction(dir_sul, "Sul", icon_sul);
+            update_direction_leds(leds_sul);
         } else if (vrx_value < 100 && vry_value > 1000 && vry_value < 3000) {
-            print_direction("Leste");
-            update_direction_leds(leste);
+            print_direction(dir_leste, "Leste", icon_leste);
+            update_direction_leds(leds_leste);
         } else if (vrx_value > 4000 && vry_value > 2000 && vry_value < 3500) {
-            print_direction("Oeste");
-            update_direction_leds(oeste);
+            print_direction(dir_oeste, "Oeste", icon_oeste);
+            update_direction_leds(leds_oeste);
         } else if (vrx_value > 3000 && vrx_value < 4000 && vry_value > 3000 && vry_value < 4000) {
-            print_direction("Nordeste");
-            update_direction_leds(nordeste);
+            print_direction(dir_nordeste, "Nordeste", icon_nordeste);
+            update_direction_leds(leds_nordeste);
         } else if (vrx_value < 2000 && vry_value > 3000) {
-            update_direction_leds(noroeste);
-            print_direction("Noroeste");           
+            update_direction_leds(leds_noroeste);
+            print_direction(dir_noroeste, "Noroeste", icon_noroeste);           
         } else if (vrx_value < 2000 && vry_value < 1000) {
-            print_direction("Sudeste");
-            update_direction_leds(sudeste);
+            print_direction(dir_sudeste, "Sudeste", icon_sudeste);
+            update_direction_leds(leds_sudeste);
         } else if (vrx_value > 3000 && vry_value < 2000) {
-            print_direction("Sudoeste");
-            update_direction_leds(sudoeste);
+            print_direction(dir_sudoeste, "Sudoeste", icon_sudoeste);
+            update_direction_leds(leds_sudoeste);
         } else if(vrx_value > 1900 && vrx_value < 2100 && vry_value > 1900 && vry_value < 2100){
-            update_direction_leds(centro);
-            print_direction("Centro");
+            update_direction_leds(leds_centro);
+            print_direction(dir_centro, "Centro", NULL);
         }
+
+        cyw43_arch_lwip_begin();
+        published_state.version = status_version;
+        published_state.x = vrx_value;
+        published_state.y = vry_value;
+        published_state.direction_code = direction_code;
+        strcpy(published_state.direction, direction);
+        cyw43_arch_lwip_end();
+    }
+}
+
+// Envia uma amostra do joystick aos clientes do WebSocket. Clientes atrasados perdem amostras (as
+// intermediárias se fundem na seguinte, ver httpd_websocket_broadcast)
+void stream_joystick(uint16_t x, uint16_t y) {
+    if (httpd_websocket_clients() == 0) {
+        return;
     }
+
+    struct joystick_sample sample = {
+        .time_ms = to_ms_since_boot(get_absolute_time()),
+        .x = x,
+        .y = y,
+        .direction = direction_code,
+    };
+
+    cyw43_arch_lwip_begin();
+    httpd_websocket_broadcast(&sample, sizeof(sample));
+    cyw43_arch_lwip_end();
 }
 
 int main() {
     stdio_init_all(); 
     init_hardware();
     wifi_connection();
+
+    cyw43_arch_lwip_begin();
     start_http_server();
+    cyw43_arch_lwip_end();
 
+    // Uma leitura do joystick a cada amostra do WebSocket (JOYSTICK_STREAM_HZ); a direção, o display e os LEDs
+    // seguem a cada 100 ms com a mesma leitura. A rede roda nas interrupções do cyw43 (threadsafe_background):
+    // entre as amostras o laço apenas dorme
+    absolute_time_t next_sample = get_absolute_time();
+    absolute_time_t next_monitor = get_absolute_time();
 
     while (true) {
-        cyw43_arch_poll();
-        monitor_joystick();
-        sleep_ms(100);
+        uint16_t x, y;
+
+        joystick_read_axis(&x, &y);
+        if (time_reached(next_monitor)) {
+            monitor_joystick(x, y);
+            next_monitor = delayed_by_ms(next_monitor, 100);
+        }
+        stream_joystick(x, y);
+
+        // Atrasado (uma atualização demorada do display ou dos LEDs), o ritmo recomeça de agora em vez de
+        // enviar as amostras perdidas em rajada
+        next_sample = delayed_by_us(next_sample, 1000000 / JOYSTICK_STREAM_HZ);
+        if (time_reached(next_sample)) {
+            next_sample = get_absolute_time();
+        }
+        sleep_until(next_sample);
     }
 
     cyw43_arch_deinit();
@@ -0,0 +1,28 @@
+// Recebe as amostras do joystick pelo WebSocket /ws (9 bytes, little-endian: tempo em ms, X, Y e código da
+// direção); sem WebSocket, busca /api/status a cada segundo
+const names = ['Centro', 'Norte', 'Nordeste', 'Leste', 'Sudeste', 'Sul', 'Sudoeste', 'Oeste', 'Noroeste'];
+const show = (id, text) => document.getElementById(id).textContent = text;
+
+async function update() {
+  try {
+    const status = await (await fetch('/api/status')).json();
+    show('x', status.x);
+    show('y', status.y);
+    show('direction', status.direction);
+  } catch (e) {}
+  setTimeout(update, 1000);
+}
+
+function stream() {
+  const socket = new WebSocket('ws://' + location.host + '/ws');
+  socket.binaryType = 'arraybuffer';
+  socket.onmessage = (event) => {
+    const sample = new DataView(event.data);
+    show('x', sample.getUint16(4, true));
+    show('y', sample.getUint16(6, true));
+    show('direction', names[sample.getUint8(8)]);
+  };
+  socket.onerror = () => update();
+}
+
+window.WebSocket ? stream() : update();
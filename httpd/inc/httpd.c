@@ -0,0 +1,1216 @@
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "pico/rand.h"
+#include "lwip/tcp.h"
+#include "lwip/stats.h"
+#include "httpd.h"
+
+// Conexões atendidas; a posição é liberada ao fechar, abortar ou quando o lwIP descarta o pcb
+static struct httpd_connection connections[httpd_max_connections];
+
+#if httpd_max_connections > MEMP_NUM_TCP_PCB
+#error "httpd_max_connections passa de MEMP_NUM_TCP_PCB (lwipopts.h)"
+#endif
+
+// Contadores do servidor, expostos por httpd_write_metrics
+static struct {
+    uint32_t requests;
+    uint32_t bytes_sent;
+    uint32_t accepted;
+    uint32_t refused;
+    uint32_t timed_out;
+    uint32_t responses; // Respostas completas, com o tempo somado em response_us
+    uint64_t response_us;
+} httpd_counters;
+
+// tcp_write contando os bytes enfileirados
+static err_t httpd_write(struct tcp_pcb *pcb, const void *data, u16_t length, u8_t flags) {
+    err_t err = tcp_write(pcb, data, length, flags);
+
+    if (err == ERR_OK) {
+        httpd_counters.bytes_sent += length;
+    }
+    return err;
+}
+
+// Resposta inteiramente entregue ao TCP: soma o tempo desde o primeiro byte da requisição
+static void httpd_response_done(struct httpd_connection *connection) {
+    connection->response.active = false;
+    if (connection->request_start) {
+        httpd_counters.response_us += time_us_64() - connection->request_start;
+        httpd_counters.responses++;
+        connection->request_start = 0;
+    }
+}
+
+static const char *httpd_reason(int status) {
+    switch (status) {
+        case 200: return "OK";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        default: return "Internal Server Error";
+    }
+}
+
+// Prepara a conexão para a próxima requisição (keep-alive ou pipelining)
+static void httpd_reset_request(struct httpd_connection *connection) {
+    connection->state = httpd_parse_request_line;
+    connection->bad_request = false;
+    connection->line_length = 0;
+    connection->line_truncated = false;
+    connection->body_remaining = 0;
+    memset(&connection->request, 0, sizeof(connection->request));
+}
+
+// Libera os dados recebidos e ainda não analisados
+static void httpd_drop_input(struct httpd_connection *connection) {
+    if (connection->input) {
+        pbuf_free(connection->input);
+        connection->input = NULL;
+    }
+}
+
+// Fecha a conexão e libera a posição; o lwIP ainda entrega o que já foi escrito antes do FIN. Se não tiver
+// memória para fechar, a conexão é abortada. Retorna o valor que a callback em andamento deve devolver ao lwIP
+static err_t httpd_close(struct httpd_connection *connection) {
+    struct tcp_pcb *pcb = connection->pcb;
+    err_t err = ERR_OK;
+
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, NULL);
+    tcp_sent(pcb, NULL);
+    tcp_poll(pcb, NULL, 0);
+    tcp_err(pcb, NULL);
+    if (tcp_close(pcb) != ERR_OK) {
+        tcp_abort(pcb);
+        err = ERR_ABRT;
+    }
+
+    httpd_drop_input(connection);
+    connection->in_use = false;
+    connection->pcb = NULL;
+    return err;
+}
+
+// Descarta a conexão sem esperar o cliente (RST)
+static err_t httpd_abort(struct httpd_connection *connection) {
+    tcp_arg(connection->pcb, NULL);
+    tcp_abort(connection->pcb);
+
+    httpd_drop_input(connection);
+    connection->in_use = false;
+    connection->pcb = NULL;
+    return ERR_ABRT;
+}
+
+// Corpo gerado aos poucos (httpd_send_stream): as linhas do writer enchem o buffer de rascunho, que vai ao lwIP
+// inteiro quando o buffer de envio tiver espaço, e só então o writer é chamado de novo. Com HTTP/1.1, cada
+// bloco é um chunk ("Transfer-Encoding: chunked"); com HTTP/1.0, o fim do corpo é o fim da conexão
+static err_t httpd_send_stream_pending(struct httpd_connection *connection) {
+    struct httpd_response *response = &connection->response;
+    int header = response->chunked ? 6 : 0; // "%04x\r\n"
+    int trailer = response->chunked ? 2 + 5 : 0; // "\r\n" do bloco e o "0\r\n\r\n" final
+
+    while (response->active) {
+        if (response->stream_length > 0) {
+            if (tcp_sndbuf(connection->pcb) < response->stream_length) {
+                return ERR_OK;
+            }
+            err_t err = httpd_write(connection->pcb, response->scratch, response->stream_length, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+            if (err == ERR_MEM) {
+                return ERR_OK;
+            }
+            if (err != ERR_OK) {
+                return err;
+            }
+            response->stream_length = 0;
+        }
+
+        if (response->stream_done) {
+            httpd_response_done(connection);
+            break;
+        }
+
+        int used = header;
+
+        while (true) {
+            int room = httpd_scratch_length - used - trailer;
+            int length = response->stream(response->stream_index, response->scratch + used, room, response->stream_arg);
+
+            if (length < 0) {
+                response->stream_done = true;
+                break;
+            }
+            if (length >= room && used > header) {
+                break;
+            }
+            // Uma linha maior que o buffer inteiro é descartada
+            if (length < room) {
+                used += length;
+            }
+            response->stream_index++;
+        }
+
+        if (response->chunked) {
+            if (used > header) {
+                char size[8];
+
+                snprintf(size, sizeof(size), "%04x\r\n", used - header);
+                memcpy(response->scratch, size, header);
+                memcpy(response->scratch + used, "\r\n", 2);
+                used += 2;
+            }
+            else {
+                used = 0;
+            }
+            if (response->stream_done) {
+                memcpy(response->scratch + used, "0\r\n\r\n", 5);
+                used += 5;
+            }
+        }
+        response->stream_length = used;
+    }
+    return ERR_OK;
+}
+
+// Escreve o que couber da resposta em andamento: limitado pelo tcp_sndbuf e, se a fila de segmentos do
+// lwIP encher, pelo ERR_MEM do tcp_write. O restante segue em httpd_sent, conforme o cliente confirma, ou no
+// próximo poll. Os textos do template vão por referência (ficam na flash); cabeçalho e campos, copiados.
+// Retorna o erro do lwIP que não seja falta de espaço
+static err_t httpd_send_pending(struct httpd_connection *connection) {
+    struct httpd_response *response = &connection->response;
+    int count = response->template ? response->template->count : 0;
+    err_t err = ERR_OK;
+
+    while (response->active) {
+        const struct httpd_chunk *chunk = NULL;
+        const char *data;
+        uint32_t length;
+        uint8_t flags = TCP_WRITE_FLAG_MORE;
+
+        if (response->piece >= 0 && response->stream) {
+            err = httpd_send_stream_pending(connection);
+            break;
+        }
+        if (response->piece > count || (response->piece == count && !response->body)) {
+            httpd_response_done(connection);
+            break;
+        }
+
+        if (response->piece == count) {
+            data = (const char *) response->body;
+            length = response->body_length;
+        }
+        else if (response->piece < 0) {
+            data = response->head;
+            length = response->head_length;
+            flags |= TCP_WRITE_FLAG_COPY;
+        }
+        else if ((chunk = &response->template->chunks[response->piece])->text) {
+            data = chunk->text;
+            length = chunk->length;
+        }
+        else {
+            data = response->scratch + response->field_offset;
+            length = response->field_index < response->fields ? response->field_length[response->field_index] : 0;
+            flags |= TCP_WRITE_FLAG_COPY;
+        }
+
+        uint32_t remaining = length - response->offset;
+
+        if (remaining > 0) {
+            uint32_t room = tcp_sndbuf(connection->pcb);
+            uint32_t size = remaining < room ? remaining : room;
+
+            if (size == 0) {
+                break;
+            }
+            err = httpd_write(connection->pcb, data + response->offset, size, flags);
+            if (err == ERR_MEM) {
+                err = ERR_OK;
+                break;
+            }
+            if (err != ERR_OK) {
+                break;
+            }
+            response->offset += size;
+            if (size < remaining) {
+                break;
+            }
+        }
+
+        // Parte concluída
+        if (chunk && !chunk->text && response->field_index < response->fields) {
+            response->field_offset += length;
+            response->field_index++;
+        }
+        response->piece++;
+        response->offset = 0;
+    }
+
+    if (err != ERR_OK) {
+        response->active = false;
+        connection->closing = true;
+        return err;
+    }
+    return tcp_output(connection->pcb);
+}
+
+// Monta a linha de estado e os cabeçalhos e começa o envio do que o chamador pôs em response (template, campos e
+// corpo); Connection segue a decisão de keep-alive da requisição. Com content_length negativo, não há
+// Content-Length (corpo em chunks ou até o fim da conexão); sem content_type, a resposta não descreve corpo,
+// como num 304. O ETag marcado vale só para esta resposta
+static err_t httpd_send_head(struct httpd_connection *connection, int status, const char *content_type, const char *headers, int content_length) {
+    struct httpd_response *response = &connection->response;
+    char entity[96] = "";
+    char etag[httpd_etag_max_length + 8] = "";
+
+    if (content_type) {
+        int length = snprintf(entity, sizeof(entity), "Content-Type: %s\r\n", content_type);
+
+        if (content_length >= 0) {
+            snprintf(entity + length, sizeof(entity) - length, "Content-Length: %d\r\n", content_length);
+        }
+    }
+    if (response->etag[0]) {
+        snprintf(etag, sizeof(etag), "ETag: %s\r\n", response->etag);
+        response->etag[0] = '\0';
+    }
+
+    int length = snprintf(response->head, sizeof(response->head),
+                          "HTTP/1.1 %d %s\r\n"
+                          "%s"
+                          "Connection: %s\r\n"
+                          "%s"
+                          "%s\r\n",
+                          status, httpd_reason(status), entity,
+                          connection->request.keep_alive ? "keep-alive" : "close", etag, headers ? headers : "");
+
+    if (length >= (int) sizeof(response->head)) {
+        return ERR_VAL;
+    }
+
+    response->active = true;
+    response->piece = -1;
+    response->offset = 0;
+    response->head_length = length;
+    response->field_offset = 0;
+    response->field_index = 0;
+    return httpd_send_pending(connection);
+}
+
+// Envia uma resposta 200 montada a partir de um template. Os campos dinâmicos são formatados antes, no buffer
+// de rascunho da conexão, para que o Content-Length seja conhecido. O que não couber no buffer de envio do
+// TCP segue depois, por httpd_sent; as requisições seguintes da conexão esperam a resposta terminar
+err_t httpd_send_template(struct httpd_connection *connection, const struct httpd_template *template, httpd_field_writer_t writer, void *arg) {
+    struct httpd_response *response = &connection->response;
+    int used = 0;
+    int fields = 0;
+    int content_length = 0;
+
+    for (int i = 0; i < template->count; i++) {
+        const struct httpd_chunk *chunk = &template->chunks[i];
+
+        if (chunk->text) {
+            content_length += chunk->length;
+            continue;
+        }
+
+        int room = httpd_scratch_length - used;
+        int length = 0;
+
+        if (fields < httpd_max_fields && room > 1) {
+            length = writer(chunk->field, response->scratch + used, room < httpd_field_max_length ? room : httpd_field_max_length, arg);
+            if (length < 0) {
+                length = 0;
+            }
+            if (length >= room || length >= httpd_field_max_length) {
+                length = (room < httpd_field_max_length ? room : httpd_field_max_length) - 1;
+            }
+        }
+        if (fields < httpd_max_fields) {
+            response->field_length[fields++] = length;
+        }
+        used += length;
+        content_length += length;
+    }
+
+    response->template = template;
+    response->fields = fields;
+    response->body = NULL;
+    response->stream = NULL;
+    return httpd_send_head(connection, 200, template->content_type, template->headers, content_length);
+}
+
+// Envia uma resposta sem corpo (erros do parser e do roteamento)
+err_t httpd_send_status(struct httpd_connection *connection, int status) {
+    connection->response.template = NULL;
+    connection->response.stream = NULL;
+    connection->response.fields = 0;
+    connection->response.body = NULL;
+    return httpd_send_head(connection, status, "text/plain", NULL, 0);
+}
+
+// Envia um corpo de tamanho desconhecido, gerado pelo writer linha a linha conforme o buffer de envio do TCP
+// libera espaço, sem montar a resposta inteira na memória. O writer é chamado no contexto do lwIP, em várias
+// callbacks, e arg precisa continuar válido até o fim do envio
+err_t httpd_send_stream(struct httpd_connection *connection, const char *content_type, const char *headers, httpd_stream_writer_t writer, void *arg) {
+    struct httpd_response *response = &connection->response;
+    char stream_headers[128];
+
+    // Sem chunked no HTTP/1.0: o corpo termina com a conexão
+    response->chunked = connection->request.http_1_1;
+    if (!response->chunked) {
+        connection->request.keep_alive = false;
+    }
+    snprintf(stream_headers, sizeof(stream_headers), "%s%s", response->chunked ? "Transfer-Encoding: chunked\r\n" : "", headers ? headers : "");
+
+    response->template = NULL;
+    response->fields = 0;
+    response->body = NULL;
+    response->stream = writer;
+    response->stream_arg = arg;
+    response->stream_index = 0;
+    response->stream_length = 0;
+    response->stream_done = false;
+    return httpd_send_head(connection, 200, content_type, stream_headers, -1);
+}
+
+// Formata uma métrica no formato de exposição em texto do Prometheus (HELP, TYPE e a amostra), para writers de
+// /metrics. Retorna o tamanho como snprintf
+int httpd_format_metric(char *buffer, int size, const char *name, const char *type, const char *help, double value) {
+    return snprintf(buffer, size, "# HELP %s %s\n# TYPE %s %s\n%s %.10g\n", name, help, name, type, name, value);
+}
+
+// Conexões em uso
+static int httpd_active_connections() {
+    int count = 0;
+
+    for (int i = 0; i < httpd_max_connections; i++) {
+        count += connections[i].in_use;
+    }
+    return count;
+}
+
+// Métricas do servidor e do lwIP (as do lwIP só com LWIP_STATS, ligado no lwipopts.h fora do NDEBUG), uma por
+// índice, para compor o writer de /metrics de cada projeto. Retorna -1 depois da última
+int httpd_write_metrics(int index, char *buffer, int size) {
+    switch (index) {
+        case 0: return httpd_format_metric(buffer, size, "httpd_requests_total", "counter", "Requisições atendidas", httpd_counters.requests);
+        case 1: return httpd_format_metric(buffer, size, "httpd_sent_bytes_total", "counter", "Bytes entregues ao TCP", httpd_counters.bytes_sent);
+        case 2: return httpd_format_metric(buffer, size, "httpd_connections", "gauge", "Conexões abertas", httpd_active_connections());
+        case 3: return httpd_format_metric(buffer, size, "httpd_connections_accepted_total", "counter", "Conexões aceitas", httpd_counters.accepted);
+        case 4: return httpd_format_metric(buffer, size, "httpd_connections_refused_total", "counter", "Conexões recusadas sem posição livre", httpd_counters.refused);
+        case 5: return httpd_format_metric(buffer, size, "httpd_connections_timed_out_total", "counter", "Conexões abortadas sem confirmação do cliente", httpd_counters.timed_out);
+#if LWIP_STATS && TCP_STATS
+        case 6: return httpd_format_metric(buffer, size, "lwip_tcp_segments_sent_total", "counter", "Segmentos TCP enviados", lwip_stats.tcp.xmit);
+        case 7: return httpd_format_metric(buffer, size, "lwip_tcp_segments_received_total", "counter", "Segmentos TCP recebidos", lwip_stats.tcp.recv);
+        case 8: return httpd_format_metric(buffer, size, "lwip_tcp_segments_dropped_total", "counter", "Segmentos TCP descartados", lwip_stats.tcp.drop);
+        case 9: return httpd_format_metric(buffer, size, "lwip_tcp_memory_errors_total", "counter", "Falhas de memória no TCP", lwip_stats.tcp.memerr);
+#endif
+#if LWIP_STATS && IP_STATS
+        case 10: return httpd_format_metric(buffer, size, "lwip_ip_packets_received_total", "counter", "Pacotes IP recebidos", lwip_stats.ip.recv);
+        case 11: return httpd_format_metric(buffer, size, "lwip_ip_packets_sent_total", "counter", "Pacotes IP enviados", lwip_stats.ip.xmit);
+        case 12: return httpd_format_metric(buffer, size, "lwip_ip_packets_dropped_total", "counter", "Pacotes IP descartados", lwip_stats.ip.drop);
+#endif
+        case 13:
+            return snprintf(buffer, size, "# HELP httpd_response_seconds Tempo de resposta\n"
+                                          "# TYPE httpd_response_seconds summary\n"
+                                          "httpd_response_seconds_sum %.6f\n"
+                                          "httpd_response_seconds_count %lu\n",
+                            httpd_counters.response_us / 1e6, (unsigned long) httpd_counters.responses);
+        default: return index < 14 ? 0 : -1;
+    }
+}
+
+// Identifica esta execução nos ETags de versão: a versão recomeça do zero a cada boot
+static uint32_t httpd_boot_id;
+
+// Se o If-None-Match da requisição lista o ETag ("*" vale para qualquer um)
+static bool httpd_etag_matches(const struct httpd_request *request, const char *etag) {
+    return strcmp(request->if_none_match, "*") == 0 || strstr(request->if_none_match, etag) != NULL;
+}
+
+// Marca a resposta com o ETag da versão do estado que ela mostra. Retorna true se o cliente já tem essa versão
+// (If-None-Match): o handler responde então com httpd_send_not_modified, sem formatar o corpo
+bool httpd_set_version(struct httpd_connection *connection, const struct httpd_request *request, uint32_t version) {
+    char *etag = connection->response.etag;
+
+    snprintf(etag, httpd_etag_max_length, "\"%08lx-%lu\"", (unsigned long) httpd_boot_id, (unsigned long) version);
+    return httpd_etag_matches(request, etag);
+}
+
+// Responde 304 só com os cabeçalhos: o ETag marcado e os cabeçalhos de cache da resposta completa (headers)
+err_t httpd_send_not_modified(struct httpd_connection *connection, const char *headers) {
+    connection->response.template = NULL;
+    connection->response.stream = NULL;
+    connection->response.fields = 0;
+    connection->response.body = NULL;
+    return httpd_send_head(connection, 304, NULL, headers, -1);
+}
+
+// Busca binária do arquivo estático do caminho; um caminho terminado em "/" procura o index.html do diretório.
+// Retorna NULL se não houver
+const struct httpd_asset *httpd_find_asset(const struct httpd_asset_store *store, const char *path) {
+    char index[httpd_path_max_length + sizeof("index.html")];
+    int length = strlen(path);
+
+    if (length > 0 && path[length - 1] == '/' && length < httpd_path_max_length) {
+        memcpy(index, path, length);
+        strcpy(index + length, "index.html");
+        path = index;
+    }
+
+    int low = 0;
+    int high = store->count - 1;
+
+    while (low <= high) {
+        int middle = (low + high) / 2;
+        int order = strcmp(path, store->assets[middle].path);
+
+        if (order == 0) {
+            return &store->assets[middle];
+        }
+        if (order < 0) {
+            high = middle - 1;
+        }
+        else {
+            low = middle + 1;
+        }
+    }
+    return NULL;
+}
+
+// Envia um arquivo estático já comprimido, direto da flash, ou 304 se o cliente já tem o conteúdo (ETag). Todo
+// navegador aceita gzip, então o Accept-Encoding não é consultado
+err_t httpd_send_asset(struct httpd_connection *connection, const struct httpd_asset *asset) {
+    char headers[96];
+
+    if (!asset) {
+        return httpd_send_status(connection, 404);
+    }
+
+    strcpy(connection->response.etag, asset->etag);
+    if (httpd_etag_matches(&connection->request, asset->etag)) {
+        snprintf(headers, sizeof(headers), "Cache-Control: %s\r\nVary: Accept-Encoding\r\n", asset->cache_control);
+        return httpd_send_not_modified(connection, headers);
+    }
+
+    snprintf(headers, sizeof(headers), "Content-Encoding: gzip\r\nCache-Control: %s\r\nVary: Accept-Encoding\r\n", asset->cache_control);
+    connection->response.template = NULL;
+    connection->response.stream = NULL;
+    connection->response.fields = 0;
+    connection->response.body = asset->data;
+    connection->response.body_length = asset->length;
+    return httpd_send_head(connection, 200, asset->content_type, headers, asset->length);
+}
+
+// Converte a conexão num fluxo de Server-Sent Events (text/event-stream). A resposta fica aberta, sem
+// Content-Length, e os eventos seguem por httpd_send_event
+err_t httpd_begin_events(struct httpd_connection *connection) {
+    static const char head[] = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/event-stream\r\n"
+                               "Cache-Control: no-store\r\n"
+                               "Connection: keep-alive\r\n"
+                               "\r\n";
+    err_t err = httpd_write(connection->pcb, head, sizeof(head) - 1, 0);
+
+    if (err != ERR_OK) {
+        return err;
+    }
+
+    connection->events = true;
+    connection->request.keep_alive = true;
+    return tcp_output(connection->pcb);
+}
+
+// Envia "data: <data>\n\n" a todas as conexões de eventos. Um cliente cujo buffer de envio ainda não tem
+// espaço para o evento o perde (o próximo traz o estado atualizado), sem atrasar os demais. Deve ser chamada
+// no contexto do lwIP (ou entre cyw43_arch_lwip_begin e cyw43_arch_lwip_end). Retorna quantos clientes o receberam
+int httpd_send_event(const char *data) {
+    char event[httpd_event_max_length];
+    int length = snprintf(event, sizeof(event), "data: %s\n\n", data);
+    int delivered = 0;
+
+    if (length >= (int) sizeof(event)) {
+        return 0;
+    }
+
+    for (int i = 0; i < httpd_max_connections; i++) {
+        struct httpd_connection *connection = &connections[i];
+
+        if (!connection->in_use || !connection->events || tcp_sndbuf(connection->pcb) < length) {
+            continue;
+        }
+        if (httpd_write(connection->pcb, event, length, TCP_WRITE_FLAG_COPY) == ERR_OK) {
+            tcp_output(connection->pcb);
+            delivered++;
+        }
+    }
+
+    return delivered;
+}
+
+// Quantidade de conexões de eventos abertas, para evitar montar eventos sem ninguém para recebê-los
+int httpd_event_clients() {
+    int count = 0;
+
+    for (int i = 0; i < httpd_max_connections; i++) {
+        count += connections[i].in_use && connections[i].events;
+    }
+    return count;
+}
+
+// SHA-1 (FIPS 180-4), usado apenas para o Sec-WebSocket-Accept do handshake
+static uint32_t httpd_rotl(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
+}
+
+static void httpd_sha1_block(uint32_t state[5], const uint8_t block[64]) {
+    uint32_t w[80];
+
+    for (int i = 0; i < 16; i++) {
+        w[i] = (uint32_t) block[i * 4] << 24 | (uint32_t) block[i * 4 + 1] << 16 | (uint32_t) block[i * 4 + 2] << 8 | block[i * 4 + 3];
+    }
+    for (int i = 16; i < 80; i++) {
+        w[i] = httpd_rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+    for (int i = 0; i < 80; i++) {
+        uint32_t f, k;
+
+        if (i < 20) {
+            f = (b & c) | (~b & d);
+            k = 0x5A827999;
+        }
+        else if (i < 40) {
+            f = b ^ c ^ d;
+            k = 0x6ED9EBA1;
+        }
+        else if (i < 60) {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8F1BBCDC;
+        }
+        else {
+            f = b ^ c ^ d;
+            k = 0xCA62C1D6;
+        }
+
+        uint32_t temp = httpd_rotl(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = httpd_rotl(b, 30);
+        b = a;
+        a = temp;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+static void httpd_sha1(const uint8_t *data, int length, uint8_t digest[20]) {
+    uint32_t state[5] = {0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+    uint8_t block[64];
+    int i = 0;
+
+    for (; length - i >= 64; i += 64) {
+        httpd_sha1_block(state, data + i);
+    }
+
+    // Último bloco: resto dos dados, o bit 1, zeros e o tamanho em bits (em um ou dois blocos)
+    int rest = length - i;
+    memset(block, 0, sizeof(block));
+    memcpy(block, data + i, rest);
+    block[rest] = 0x80;
+    if (rest >= 56) {
+        httpd_sha1_block(state, block);
+        memset(block, 0, sizeof(block));
+    }
+
+    uint64_t bits = (uint64_t) length * 8;
+    for (int j = 0; j < 8; j++) {
+        block[63 - j] = bits >> (j * 8);
+    }
+    httpd_sha1_block(state, block);
+
+    for (int j = 0; j < 20; j++) {
+        digest[j] = state[j / 4] >> (24 - (j % 4) * 8);
+    }
+}
+
+static void httpd_base64(const uint8_t *data, int length, char *out) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    for (int i = 0; i < length; i += 3) {
+        uint32_t triple = data[i] << 16 | (i + 1 < length ? data[i + 1] << 8 : 0) | (i + 2 < length ? data[i + 2] : 0);
+
+        *out++ = alphabet[(triple >> 18) & 0x3F];
+        *out++ = alphabet[(triple >> 12) & 0x3F];
+        *out++ = i + 1 < length ? alphabet[(triple >> 6) & 0x3F] : '=';
+        *out++ = i + 2 < length ? alphabet[triple & 0x3F] : '=';
+    }
+    *out = '\0';
+}
+
+// Envia um quadro WebSocket do servidor (sem máscara). Payloads de até 65535 bytes
+static err_t httpd_websocket_write(struct httpd_connection *connection, uint8_t opcode, const void *data, int length) {
+    uint8_t header[4] = {0x80 | opcode};
+    int header_length = 2;
+
+    if (length < 126) {
+        header[1] = length;
+    }
+    else {
+        header[1] = 126;
+        header[2] = length >> 8;
+        header[3] = length;
+        header_length = 4;
+    }
+
+    err_t err = httpd_write(connection->pcb, header, header_length, TCP_WRITE_FLAG_COPY | TCP_WRITE_FLAG_MORE);
+    if (err == ERR_OK && length > 0) {
+        err = httpd_write(connection->pcb, data, length, TCP_WRITE_FLAG_COPY);
+    }
+    return err == ERR_OK ? tcp_output(connection->pcb) : err;
+}
+
+// Quadro do cliente completo: close é respondido e encerra a conexão, ping recebe pong com o mesmo payload.
+// Mensagens de dados do cliente são ignoradas
+static void httpd_websocket_frame(struct httpd_connection *connection, uint8_t opcode, int length) {
+    switch (opcode) {
+        case 0x8:
+            httpd_websocket_write(connection, 0x8, connection->line, length >= 2 ? 2 : 0);
+            connection->closing = true;
+            break;
+        case 0x9:
+            httpd_websocket_write(connection, 0xA, connection->line, length);
+            break;
+    }
+}
+
+// Consome bytes de quadros do cliente e retorna quantos usou. O cabeçalho é acumulado em frame_header; o
+// payload dos quadros de controle (até 125 bytes pela RFC 6455, aqui até httpd_line_max_length) é
+// desmascarado em connection->line, e o dos demais é descartado
+static int httpd_parse_websocket(struct httpd_connection *connection, const char *data, int length) {
+    int used = 0;
+
+    while (used < length && !connection->closing) {
+        uint8_t *header = connection->frame_header;
+
+        if (connection->frame_header_length < connection->frame_header_needed) {
+            header[connection->frame_header_length++] = data[used++];
+
+            if (connection->frame_header_length == 2) {
+                int size_code = header[1] & 0x7F;
+
+                // Quadros do cliente sempre vêm mascarados
+                if (!(header[1] & 0x80)) {
+                    connection->closing = true;
+                    break;
+                }
+                connection->frame_header_needed = 2 + (size_code == 126 ? 2 : size_code == 127 ? 8 : 0) + 4;
+            }
+            if (connection->frame_header_length < connection->frame_header_needed) {
+                continue;
+            }
+
+            int size_code = header[1] & 0x7F;
+            uint32_t payload = size_code;
+
+            if (size_code == 126) {
+                payload = header[2] << 8 | header[3];
+            }
+            else if (size_code == 127) {
+                payload = (uint32_t) header[6] << 24 | header[7] << 16 | header[8] << 8 | header[9];
+            }
+
+            // Quadros de controle precisam caber no buffer para serem respondidos
+            if ((header[0] & 0x08) && payload > httpd_line_max_length) {
+                connection->closing = true;
+                break;
+            }
+            connection->frame_remaining = payload;
+            connection->line_length = 0;
+        }
+        else {
+            uint32_t available = length - used;
+            uint32_t take = available < connection->frame_remaining ? available : connection->frame_remaining;
+
+            if (connection->frame_header[0] & 0x08) {
+                const uint8_t *mask = header + connection->frame_header_needed - 4;
+
+                for (uint32_t i = 0; i < take; i++, connection->line_length++) {
+                    connection->line[connection->line_length] = data[used + i] ^ mask[connection->line_length % 4];
+                }
+            }
+            used += take;
+            connection->frame_remaining -= take;
+        }
+
+        if (connection->frame_remaining == 0) {
+            httpd_websocket_frame(connection, header[0] & 0x0F, connection->line_length);
+            connection->frame_header_length = 0;
+            connection->frame_header_needed = 2;
+            connection->line_length = 0;
+        }
+    }
+
+    return used > 0 ? used : 1;
+}
+
+// Conclui o handshake do WebSocket (RFC 6455, 4.2.2): Sec-WebSocket-Accept é o base64 do SHA-1 da chave do
+// cliente com o GUID fixo. Requisições sem "Upgrade: websocket" ou sem chave recebem 400. A partir daqui a
+// conexão troca quadros, e o Nagle é desligado para que mensagens pequenas saiam sem espera
+err_t httpd_begin_websocket(struct httpd_connection *connection, const struct httpd_request *request) {
+    static const char guid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+    char key[httpd_websocket_key_length + sizeof(guid)];
+    char accept[29];
+    char head[160];
+    uint8_t digest[20];
+
+    if (!request->websocket || request->websocket_key[0] == '\0') {
+        connection->request.keep_alive = false;
+        return httpd_send_status(connection, 400);
+    }
+
+    strcpy(key, request->websocket_key);
+    strcat(key, guid);
+    httpd_sha1((const uint8_t *) key, strlen(key), digest);
+    httpd_base64(digest, sizeof(digest), accept);
+
+    int length = snprintf(head, sizeof(head),
+                          "HTTP/1.1 101 Switching Protocols\r\n"
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Accept: %s\r\n"
+                          "\r\n", accept);
+    err_t err = httpd_write(connection->pcb, head, length, TCP_WRITE_FLAG_COPY);
+
+    if (err != ERR_OK) {
+        return err;
+    }
+
+    connection->websocket = true;
+    connection->request.keep_alive = true;
+    connection->frame_header_length = 0;
+    connection->frame_header_needed = 2;
+    tcp_nagle_disable(connection->pcb);
+    return tcp_output(connection->pcb);
+}
+
+// Envia uma mensagem binária a todos os clientes WebSocket. Um cliente com mais de httpd_websocket_max_backlog
+// bytes ainda não confirmados perde a mensagem: com amostras, a seguinte já traz o estado atual, e as
+// intermediárias se fundem nela. Deve ser chamada no contexto do lwIP (ou entre cyw43_arch_lwip_begin e
+// cyw43_arch_lwip_end). Retorna quantos clientes a receberam
+int httpd_websocket_broadcast(const void *data, int length) {
+    int delivered = 0;
+
+    for (int i = 0; i < httpd_max_connections; i++) {
+        struct httpd_connection *connection = &connections[i];
+
+        if (!connection->in_use || !connection->websocket || connection->closing) {
+            continue;
+        }
+        if (TCP_SND_BUF - tcp_sndbuf(connection->pcb) > httpd_websocket_max_backlog || tcp_sndbuf(connection->pcb) < length + 4) {
+            continue;
+        }
+        if (httpd_websocket_write(connection, 0x2, data, length) == ERR_OK) {
+            delivered++;
+        }
+    }
+
+    return delivered;
+}
+
+// Quantidade de clientes WebSocket conectados
+int httpd_websocket_clients() {
+    int count = 0;
+
+    for (int i = 0; i < httpd_max_connections; i++) {
+        count += connections[i].in_use && connections[i].websocket;
+    }
+    return count;
+}
+
+// Procura a rota da requisição e chama o handler
+static void httpd_dispatch(struct httpd_connection *connection) {
+    const struct httpd_server *server = connection->server;
+    const struct httpd_request *request = &connection->request;
+    bool path_found = false;
+    err_t err;
+
+    httpd_counters.requests++;
+
+    if (connection->bad_request) {
+        connection->request.keep_alive = false;
+        err = httpd_send_status(connection, 400);
+    }
+    else {
+        const struct httpd_route *route = NULL;
+        const struct httpd_asset *asset;
+
+        for (int i = 0; i < server->route_count && !route; i++) {
+            if (strcmp(server->routes[i].path, request->path) == 0) {
+                path_found = true;
+                if (strcmp(server->routes[i].method, request->method) == 0) {
+                    route = &server->routes[i];
+                }
+            }
+        }
+
+        if (route) {
+            err = route->handler(connection, request);
+        }
+        else if (!path_found && server->assets && strcmp(request->method, "GET") == 0 && (asset = httpd_find_asset(server->assets, request->path))) {
+            err = httpd_send_asset(connection, asset);
+        }
+        else {
+            err = httpd_send_status(connection, path_found ? 405 : 404);
+        }
+    }
+
+    // Sem como responder, a conexão não tem como seguir em ordem: fecha depois do que já foi enviado
+    if (err != ERR_OK || !connection->request.keep_alive) {
+        connection->closing = true;
+    }
+    httpd_reset_request(connection);
+}
+
+// Linha de requisição: "MÉTODO /caminho?query HTTP/1.x". HTTP/1.1 mantém a conexão por padrão
+static void httpd_parse_request(struct httpd_connection *connection) {
+    struct httpd_request *request = &connection->request;
+    char *method = connection->line;
+    char *path = strchr(method, ' ');
+    char *version = path ? strchr(path + 1, ' ') : NULL;
+
+    if (!path || !version || path - method >= httpd_method_max_length || path[1] != '/') {
+        connection->bad_request = true;
+        return;
+    }
+
+    *path++ = '\0';
+    *version++ = '\0';
+    path[strcspn(path, "?")] = '\0';
+
+    if (strlen(path) >= httpd_path_max_length || strncmp(version, "HTTP/1.", 7) != 0) {
+        connection->bad_request = true;
+        return;
+    }
+
+    strcpy(request->method, method);
+    strcpy(request->path, path);
+    request->http_1_1 = strcmp(version, "HTTP/1.1") == 0;
+    request->keep_alive = request->http_1_1;
+}
+
+// Cabeçalho: só Connection, Content-Length, If-None-Match e os do handshake do WebSocket interessam ao servidor
+static void httpd_parse_header(struct httpd_connection *connection) {
+    char *name = connection->line;
+    char *value = strchr(name, ':');
+
+    if (!value) {
+        return;
+    }
+    *value++ = '\0';
+    value += strspn(value, " \t");
+
+    if (strcasecmp(name, "Connection") == 0) {
+        if (strncasecmp(value, "close", 5) == 0) {
+            connection->request.keep_alive = false;
+        }
+        else if (strncasecmp(value, "keep-alive", 10) == 0) {
+            connection->request.keep_alive = true;
+        }
+    }
+    else if (strcasecmp(name, "Content-Length") == 0) {
+        connection->body_remaining = strtoul(value, NULL, 10);
+    }
+    else if (strcasecmp(name, "Upgrade") == 0) {
+        connection->request.websocket = strcasecmp(value, "websocket") == 0;
+    }
+    else if (strcasecmp(name, "Sec-WebSocket-Key") == 0 && strlen(value) == httpd_websocket_key_length) {
+        strcpy(connection->request.websocket_key, value);
+    }
+    else if (strcasecmp(name, "If-None-Match") == 0 && strlen(value) < httpd_if_none_match_length) {
+        strcpy(connection->request.if_none_match, value);
+    }
+}
+
+// Uma linha completa (sem o CRLF) chegou
+static void httpd_parse_line(struct httpd_connection *connection, bool truncated) {
+    if (connection->state == httpd_parse_request_line) {
+        // Linhas vazias antes da requisição são toleradas (RFC 9112, 2.2)
+        if (connection->line_length == 0) {
+            return;
+        }
+        if (truncated) {
+            connection->bad_request = true;
+        }
+        else {
+            httpd_parse_request(connection);
+        }
+        connection->state = httpd_parse_headers;
+        return;
+    }
+
+    if (connection->line_length > 0) {
+        // Um cabeçalho longo demais só pode ser um que o servidor ignora
+        if (!truncated) {
+            httpd_parse_header(connection);
+        }
+        return;
+    }
+
+    // Fim dos cabeçalhos: o corpo, se houver, é descartado antes de responder
+    if (connection->body_remaining > 0 && !connection->bad_request) {
+        connection->state = httpd_parse_body;
+    }
+    else {
+        httpd_dispatch(connection);
+    }
+}
+
+// Consome os bytes de um pbuf. Linhas são acumuladas em connection->line até o LF; o que passar do tamanho
+// do buffer é descartado e a linha marcada como truncada. Para depois de uma requisição cuja resposta ainda
+// está em envio e retorna quantos bytes consumiu
+static int httpd_parse(struct httpd_connection *connection, const char *data, int length) {
+    int i;
+
+    for (i = 0; i < length && !connection->closing && !connection->events && !connection->response.active; i++) {
+        if (connection->websocket) {
+            i += httpd_parse_websocket(connection, data + i, length - i) - 1;
+            continue;
+        }
+
+        if (connection->state == httpd_parse_body) {
+            uint32_t available = length - i;
+            uint32_t skip = available < connection->body_remaining ? available : connection->body_remaining;
+
+            connection->body_remaining -= skip;
+            i += skip - 1;
+            if (connection->body_remaining == 0) {
+                httpd_dispatch(connection);
+            }
+            continue;
+        }
+
+        char c = data[i];
+
+        if (connection->state == httpd_parse_request_line && connection->line_length == 0 && c != '\r' && c != '\n') {
+            connection->request_start = time_us_64();
+        }
+
+        if (c == '\n') {
+            if (connection->line_length > 0 && connection->line[connection->line_length - 1] == '\r') {
+                connection->line_length--;
+            }
+            connection->line[connection->line_length] = '\0';
+            httpd_parse_line(connection, connection->line_truncated);
+            connection->line_length = 0;
+            connection->line_truncated = false;
+        }
+        else if (connection->line_length < httpd_line_max_length - 1) {
+            connection->line[connection->line_length++] = c;
+        }
+        else {
+            connection->line_truncated = true;
+        }
+    }
+
+    // O que chega de uma conexão de eventos é ignorado
+    return connection->events ? length : i;
+}
+
+// Analisa os dados guardados em input enquanto nenhuma resposta estiver em envio. Só o que foi analisado é
+// confirmado com tcp_recved: com a resposta parada, a janela de recepção fecha e o cliente espera. Fecha a
+// conexão pedida para fechar quando não há mais resposta em envio
+static err_t httpd_consume(struct httpd_connection *connection) {
+    while (connection->input && !connection->closing && !connection->response.active) {
+        struct pbuf *p = connection->input;
+        int used = httpd_parse(connection, (const char *) p->payload + connection->input_offset, p->len - connection->input_offset);
+
+        connection->input_offset += used;
+        if (connection->input_offset < p->len) {
+            break;
+        }
+
+        // Primeiro pbuf da cadeia consumido: segura o resto antes de liberá-lo
+        connection->input = p->next;
+        connection->input_offset = 0;
+        if (p->next) {
+            pbuf_ref(p->next);
+        }
+        tcp_recved(connection->pcb, p->len);
+        pbuf_free(p);
+    }
+
+    if (connection->closing && !connection->response.active) {
+        return httpd_close(connection);
+    }
+    return ERR_OK;
+}
+
+// Continua a resposta em andamento e, terminada, as requisições que esperavam por ela
+static err_t httpd_resume(struct httpd_connection *connection) {
+    if (connection->response.active) {
+        httpd_send_pending(connection);
+    }
+    return httpd_consume(connection);
+}
+
+static err_t httpd_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err) {
+    struct httpd_connection *connection = arg;
+
+    // O cliente fechou a conexão: termina a resposta em envio e fecha
+    if (p == NULL) {
+        connection->closing = true;
+        return httpd_consume(connection);
+    }
+
+    connection->idle = 0;
+    if (connection->input) {
+        pbuf_cat(connection->input, p);
+    }
+    else {
+        connection->input = p;
+        connection->input_offset = 0;
+    }
+
+    return httpd_consume(connection);
+}
+
+// O cliente confirmou dados: há espaço para continuar a resposta
+static err_t httpd_sent(void *arg, struct tcp_pcb *pcb, u16_t length) {
+    struct httpd_connection *connection = arg;
+
+    connection->idle = 0;
+    return httpd_resume(connection);
+}
+
+// Chamada a cada httpd_poll_interval. Aborta a conexão cujo cliente parou de confirmar o que foi enviado,
+// fecha a conexão HTTP ociosa e retoma a resposta que parou por falta de memória no lwIP
+static err_t httpd_poll(void *arg, struct tcp_pcb *pcb) {
+    struct httpd_connection *connection = arg;
+    bool sending = connection->response.active || tcp_sndbuf(pcb) < TCP_SND_BUF;
+
+    if (connection->idle < UINT8_MAX) {
+        connection->idle++;
+    }
+
+    if (sending && connection->idle >= httpd_send_timeout) {
+        httpd_counters.timed_out++;
+        return httpd_abort(connection);
+    }
+    if (!sending && !connection->events && !connection->websocket && connection->idle >= httpd_idle_timeout) {
+        connection->closing = true;
+    }
+    return httpd_resume(connection);
+}
+
+// O lwIP já liberou o pcb (reset ou falha): apenas libera a posição
+static void httpd_error(void *arg, err_t err) {
+    struct httpd_connection *connection = arg;
+
+    if (connection) {
+        httpd_drop_input(connection);
+        connection->in_use = false;
+        connection->pcb = NULL;
+    }
+}
+
+// Conexão keep-alive sem requisição, resposta ou dados pendentes há mais tempo, que pode dar lugar a uma nova
+static struct httpd_connection *httpd_idlest() {
+    struct httpd_connection *idlest = NULL;
+
+    for (int i = 0; i < httpd_max_connections; i++) {
+        struct httpd_connection *connection = &connections[i];
+
+        if (!connection->in_use || connection->events || connection->websocket || connection->response.active ||
+            connection->input || connection->state != httpd_parse_request_line || connection->line_length > 0 ||
+            tcp_sndbuf(connection->pcb) < TCP_SND_BUF) {
+            continue;
+        }
+        if (!idlest || connection->idle > idlest->idle) {
+            idlest = connection;
+        }
+    }
+    return idlest;
+}
+
+static err_t httpd_accept(void *arg, struct tcp_pcb *pcb, err_t err) {
+    struct httpd_connection *connection = NULL;
+
+    if (err != ERR_OK || pcb == NULL) {
+        return ERR_VAL;
+    }
+
+    for (int i = 0; i < httpd_max_connections && !connection; i++) {
+        if (!connections[i].in_use) {
+            connection = &connections[i];
+        }
+    }
+
+    // Sem posição livre, a conexão keep-alive mais ociosa é fechada; sem nenhuma, a nova é recusada
+    if (!connection && (connection = httpd_idlest())) {
+        httpd_close(connection);
+    }
+    if (!connection) {
+        httpd_counters.refused++;
+        tcp_abort(pcb);
+        return ERR_ABRT;
+    }
+
+    httpd_counters.accepted++;
+
+    memset(connection, 0, sizeof(*connection));
+    connection->in_use = true;
+    connection->pcb = pcb;
+    connection->server = arg;
+    httpd_reset_request(connection);
+
+    // Sob falta de memória, o lwIP descarta primeiro estas conexões
+    tcp_setprio(pcb, TCP_PRIO_MIN);
+    tcp_arg(pcb, connection);
+    tcp_recv(pcb, httpd_recv);
+    tcp_sent(pcb, httpd_sent);
+    tcp_poll(pcb, httpd_poll, httpd_poll_interval);
+    tcp_err(pcb, httpd_error);
+    return ERR_OK;
+}
+
+// Começa a escutar na porta dada, despachando as requisições pela tabela de rotas do servidor
+err_t httpd_start(const struct httpd_server *server, uint16_t port) {
+    struct tcp_pcb *pcb = tcp_new();
+    err_t err;
+
+    if (!pcb) {
+        return ERR_MEM;
+    }
+
+    httpd_boot_id = get_rand_32();
+    err = tcp_bind(pcb, IP_ADDR_ANY, port);
+    if (err != ERR_OK) {
+        tcp_close(pcb);
+        return err;
+    }
+
+    struct tcp_pcb *listen_pcb = tcp_listen(pcb);
+    if (!listen_pcb) {
+        tcp_close(pcb);
+        return ERR_MEM;
+    }
+
+    tcp_arg(listen_pcb, (void *) server);
+    tcp_accept(listen_pcb, httpd_accept);
+    return ERR_OK;
+}
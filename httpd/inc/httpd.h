@@ -0,0 +1,186 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+#include "lwip/tcp.h"
+
+#ifndef httpd_inc_h
+#define httpd_inc_h
+
+// Conexões simultâneas (HTTPD_MAX_CONNECTIONS no CMake). Com todas ocupadas, uma conexão keep-alive ociosa
+// dá lugar à nova; sem nenhuma ociosa, a nova é recusada
+#ifndef httpd_max_connections
+#define httpd_max_connections 4
+#endif
+#define httpd_line_max_length 64 // Linha de requisição ou de cabeçalho guardada pelo parser (o excesso é descartado)
+#define httpd_path_max_length 32 // Maior caminho de requisição reconhecido (com o terminador)
+#define httpd_method_max_length 8
+#define httpd_field_max_length 64 // Tamanho máximo de cada campo dinâmico de um template
+#define httpd_scratch_length 192 // Buffer de rascunho com todos os campos dinâmicos de uma resposta
+#define httpd_head_max_length 256 // Linha de estado e cabeçalhos de uma resposta
+#define httpd_max_fields 8 // Campos dinâmicos por template
+#define httpd_event_max_length 128 // Maior evento enviado por httpd_send_event, com o "data: " e o "\n\n"
+#define httpd_websocket_key_length 24 // Sec-WebSocket-Key: 16 bytes em base64
+#define httpd_etag_max_length 24 // ETag com as aspas e o terminador
+#define httpd_if_none_match_length 48 // If-None-Match guardado da requisição (com o terminador)
+#define httpd_websocket_max_backlog 512 // Bytes enviados e ainda não confirmados acima dos quais um cliente WebSocket perde a mensagem
+#define httpd_poll_interval 2 // Intervalo do tcp_poll, em ticks de 500 ms do timer do TCP
+#define httpd_idle_timeout 10 // Polls sem tráfego após os quais uma conexão HTTP ociosa é fechada
+#define httpd_send_timeout 10 // Polls sem confirmação do cliente após os quais uma conexão com envio pendente é abortada
+
+// Trecho de um template de resposta: texto estático (na flash, enviado por referência) ou campo dinâmico,
+// formatado pela aplicação no momento do envio
+struct httpd_chunk {
+    const char *text; // NULL para um campo
+    uint16_t length;
+    int16_t field; // Identificador do campo (-1 para texto)
+};
+
+// Montam os trechos de um template; o tamanho dos textos é calculado na compilação
+#define httpd_text(literal) { literal, sizeof(literal) - 1, -1 }
+#define httpd_field(id) { NULL, 0, id }
+
+// Corpo de uma resposta e os cabeçalhos próprios dele. A linha de estado, Content-Length e Connection são
+// escritos pelo servidor
+struct httpd_template {
+    const char *content_type;
+    const char *headers; // Cabeçalhos extras, cada um terminado em "\r\n" (ou NULL)
+    const struct httpd_chunk *chunks;
+    int count;
+};
+
+#define httpd_template(content_type, headers, chunks) { content_type, headers, chunks, count_of(chunks) }
+
+// Arquivo estático comprimido com gzip, gerado de web/ por tools/web_assets_gen.py (ver httpd_add_web_assets no
+// CMakeLists.txt). Fica na flash e vai ao lwIP por referência
+struct httpd_asset {
+    const char *path;
+    const char *content_type;
+    const char *cache_control;
+    const char *etag; // Derivado do conteúdo, entre aspas
+    const uint8_t *data;
+    uint32_t length;
+};
+
+// Conjunto de arquivos ordenado pelo caminho (busca binária)
+struct httpd_asset_store {
+    const struct httpd_asset *assets;
+    int count;
+};
+
+#define httpd_asset_store(assets) { assets, count_of(assets) }
+
+// Formata o campo id em buffer (size bytes, com o terminador) e retorna o tamanho escrito, como snprintf
+typedef int (*httpd_field_writer_t)(int id, char *buffer, int size, void *arg);
+
+// Formata a linha (ou grupo de linhas) index de um corpo gerado aos poucos, como snprintf: se o retorno for
+// size ou mais, a linha não coube e é pedida de novo no próximo bloco. Retorna -1 depois da última
+typedef int (*httpd_stream_writer_t)(int index, char *buffer, int size, void *arg);
+
+// Requisição já analisada, entregue ao handler da rota
+struct httpd_request {
+    char method[httpd_method_max_length];
+    char path[httpd_path_max_length]; // Sem a query string
+    bool http_1_1;
+    bool keep_alive;
+    bool websocket; // "Upgrade: websocket"
+    char websocket_key[httpd_websocket_key_length + 1];
+    char if_none_match[httpd_if_none_match_length];
+};
+
+// Estado do parser incremental: a requisição pode chegar dividida em vários pbufs, e várias requisições
+// podem vir no mesmo pbuf (pipelining)
+enum httpd_parser_state {
+    httpd_parse_request_line,
+    httpd_parse_headers,
+    httpd_parse_body,
+};
+
+// Resposta em envio: cabeçalho e campos ficam na conexão, os textos do template seguem da flash. Escrita em
+// partes conforme o buffer de envio do TCP libera espaço (tcp_sent)
+struct httpd_response {
+    bool active;
+    const struct httpd_template *template; // NULL numa resposta sem template
+    const uint8_t *body; // Corpo enviado depois do template (arquivo estático), ou NULL
+    uint32_t body_length;
+    httpd_stream_writer_t stream; // Corpo gerado aos poucos em scratch (httpd_send_stream), ou NULL
+    void *stream_arg;
+    uint16_t stream_index; // Próxima linha pedida ao writer
+    uint16_t stream_length; // Bytes prontos em scratch, aguardando espaço no envio
+    bool stream_done;
+    bool chunked;
+    int16_t piece; // -1: cabeçalho; a partir de 0, o trecho do template e, depois deles, o corpo
+    uint32_t offset; // Bytes da parte atual já escritos
+    uint16_t head_length;
+    uint16_t field_offset; // Início do campo atual em scratch
+    uint8_t field_index;
+    uint8_t fields;
+    char etag[httpd_etag_max_length]; // ETag da próxima resposta (vazio: sem ETag)
+    uint16_t field_length[httpd_max_fields];
+    char head[httpd_head_max_length];
+    char scratch[httpd_scratch_length];
+};
+
+struct httpd_connection {
+    struct tcp_pcb *pcb;
+    const struct httpd_server *server;
+    enum httpd_parser_state state;
+    bool in_use;
+    bool closing; // Fechar depois das respostas já enfileiradas
+    bool bad_request;
+    bool line_truncated; // A linha atual passou de httpd_line_max_length
+    bool events; // Conexão convertida em fluxo de Server-Sent Events: o que chegar dela é ignorado
+    bool websocket; // Conexão convertida em WebSocket: o que chegar dela são quadros do cliente
+    uint8_t frame_header[14]; // Cabeçalho do quadro WebSocket em recepção
+    uint8_t frame_header_length;
+    uint8_t frame_header_needed;
+    uint32_t frame_remaining; // Bytes do payload do quadro ainda a receber
+    uint16_t line_length;
+    uint32_t body_remaining; // Bytes do corpo (Content-Length) ainda a descartar
+    uint8_t idle; // Polls desde o último tráfego
+    struct pbuf *input; // Dados recebidos e ainda não analisados (esperando a resposta anterior terminar)
+    uint16_t input_offset; // Bytes já analisados do primeiro pbuf de input
+    uint64_t request_start; // time_us_64 do primeiro byte da requisição em andamento (0: nenhuma)
+    char line[httpd_line_max_length];
+    struct httpd_request request;
+    struct httpd_response response;
+};
+
+// Handler de uma rota: responde com httpd_send_template, httpd_send_asset ou httpd_send_status (uma resposta
+// por requisição)
+typedef err_t (*httpd_handler_t)(struct httpd_connection *connection, const struct httpd_request *request);
+
+struct httpd_route {
+    const char *method;
+    const char *path;
+    httpd_handler_t handler;
+};
+
+// Tabela de rotas do servidor. Um GET de caminho sem rota procura o arquivo estático (".../" serve
+// ".../index.html"); sem arquivo, 404. Métodos sem rota num caminho que tem rota recebem 405
+struct httpd_server {
+    const struct httpd_route *routes;
+    int route_count;
+    const struct httpd_asset_store *assets; // Ou NULL
+};
+
+#define httpd_server(routes) { routes, count_of(routes), NULL }
+#define httpd_server_with_assets(routes, assets) { routes, count_of(routes), &assets }
+
+extern err_t httpd_start(const struct httpd_server *server, uint16_t port);
+extern err_t httpd_send_template(struct httpd_connection *connection, const struct httpd_template *template, httpd_field_writer_t writer, void *arg);
+extern err_t httpd_send_status(struct httpd_connection *connection, int status);
+extern err_t httpd_send_stream(struct httpd_connection *connection, const char *content_type, const char *headers, httpd_stream_writer_t writer, void *arg);
+extern int httpd_format_metric(char *buffer, int size, const char *name, const char *type, const char *help, double value);
+extern int httpd_write_metrics(int index, char *buffer, int size);
+extern bool httpd_set_version(struct httpd_connection *connection, const struct httpd_request *request, uint32_t version);
+extern err_t httpd_send_not_modified(struct httpd_connection *connection, const char *headers);
+extern const struct httpd_asset *httpd_find_asset(const struct httpd_asset_store *store, const char *path);
+extern err_t httpd_send_asset(struct httpd_connection *connection, const struct httpd_asset *asset);
+extern err_t httpd_begin_events(struct httpd_connection *connection);
+extern int httpd_send_event(const char *data);
+extern int httpd_event_clients();
+extern err_t httpd_begin_websocket(struct httpd_connection *connection, const struct httpd_request *request);
+extern int httpd_websocket_broadcast(const void *data, int length);
+extern int httpd_websocket_clients();
+
+#endif
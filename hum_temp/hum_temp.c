@@ -25,15 +25,15 @@
 #define OLED_I2C_BAUDRATE 400000
 
 struct render_area frame_area;
-uint8_t ssd_buffer[ssd1306_buffer_length];
+ssd1306_frame_t oled_frame;
+uint8_t *ssd_buffer = oled_frame.buffer;
+struct ssd1306_console console; // Mensagens de inicialização, com rolagem por hardware
 
 void aht10_init();
 void aht10_reset();
 bool aht10_read_data(float *humidity, float *temperature);
 
 void init_oled();
-void display_message_oled(const char *message, int line);
-void clear_oled_display();
 
 void aht10_init() {
     i2c_init(AHT10_I2C_PORT, AHT10_I2C_BAUDRATE);
@@ -50,7 +50,7 @@ void aht10_init() {
     
     if (ret == PICO_ERROR_GENERIC) {
         printf("Erro ao escrever comando de inicializacao para AHT10.\n");
-        display_message_oled("AHT10 Init Err", 0);
+        ssd1306_console_print(&console, "AHT10 Init Err");
         return;
     }
 
@@ -60,10 +60,10 @@ void aht10_init() {
     i2c_read_blocking(AHT10_I2C_PORT, AHT10_ADDR, &status, 1, false);
     if (!(status & AHT10_STATUS_CAL_MASK)) {
         printf("AHT10 NAO CALIBRADO! Tente reiniciar o sistema.\n");
-        display_message_oled("AHT10 Nao Calib.", 0);
+        ssd1306_console_print(&console, "AHT10 Nao Calib.");
     } else {
         printf("AHT10 inicializado e calibrado com sucesso.\n");
-        display_message_oled("AHT10 OK!", 0);
+        ssd1306_console_print(&console, "AHT10 OK!");
     }
 }
 
@@ -72,6 +72,7 @@ void aht10_reset() {
     int ret = i2c_write_blocking(AHT10_I2C_PORT, AHT10_ADDR, &reset_cmd, 1, false);
     if (ret == PICO_ERROR_GENERIC) {
         printf("Erro ao enviar comando de reset para AHT10.\n");
+        ssd1306_console_print(&console, "AHT10 Reset Err"); // Ignorado fora do modo console
     }
     sleep_ms(20);
 }
@@ -131,51 +132,43 @@ void init_oled() {
     printf("Display OLED inicializado no I2C1.\n");
 }
 
-void clear_oled_display() {
-    memset(ssd_buffer, 0, ssd1306_buffer_length);
-    render_on_display(ssd_buffer, &frame_area);
-}
-
-void display_message_oled(const char *message, int line) {
-    ssd1306_draw_string(ssd_buffer, 5, line * 8, message);
-}
-
 int main() {
     stdio_init_all();
 
     printf("Iniciando sistema com AHT10 e OLED...\n");
 
     init_oled();
-    clear_oled_display();
-    display_message_oled("Iniciando...", 0);
-    display_message_oled("AHT10 & OLED", 1);
-    render_on_display(ssd_buffer, &frame_area);
-    sleep_ms(2000);
-    clear_oled_display();
+    ssd1306_console_init(&console, ssd_buffer);
+    ssd1306_console_print(&console, "Iniciando...");
+    ssd1306_console_print(&console, "AHT10 & OLED");
 
     aht10_init();
+    sleep_ms(2000);
+    ssd1306_console_end(&console); // Os campos abaixo assumem a tela; o próximo envio a redesenha inteira
 
     float humidity, temperature;
-    char temp_str[32];
-    char hum_str[32];
+
+    // Campos das leituras: só os caracteres que mudam são redesenhados e enviados
+    struct ssd1306_text_field temp_field;
+    struct ssd1306_text_field hum_field;
+    ssd1306_text_field_init(&temp_field, 5, 0, 15);
+    ssd1306_text_field_init(&hum_field, 5, 16, 15);
 
     while (true) {
         if (aht10_read_data(&humidity, &temperature)) {
             printf("Umidade: %.2f %%RH, Temperatura: %.2f C\n", humidity, temperature);
             
-            snprintf(temp_str, sizeof(temp_str), "Temp: %.1f C", temperature);
-            snprintf(hum_str, sizeof(hum_str), "Umid: %.1f %%RH", humidity);
-            
-            clear_oled_display();
-            display_message_oled(temp_str, 0);
-            display_message_oled(hum_str, 2);
-            render_on_display(ssd_buffer, &frame_area);
+            ssd1306_text_field_printf(ssd_buffer, &temp_field, "Temp: %.1f C", temperature);
+            ssd1306_text_field_printf(ssd_buffer, &hum_field, "Umid: %.1f %%RH", humidity);
+            // Envio via DMA apenas do que mudou (nada, se as leituras se repetirem): o laço segue para a
+            // próxima medição enquanto o quadro está no barramento
+            render_on_display_async(ssd_buffer, &frame_area, NULL, NULL);
             
         } else {
             printf("Falha na leitura do AHT10. Tentando resetar...\n");
-            clear_oled_display();
-            display_message_oled("Erro AHT10!", 0);
-            render_on_display(ssd_buffer, &frame_area);
+            ssd1306_text_field_set(ssd_buffer, &temp_field, "Erro AHT10!");
+            ssd1306_text_field_set(ssd_buffer, &hum_field, "");
+            render_on_display_async(ssd_buffer, &frame_area, NULL, NULL);
             aht10_reset();
             sleep_ms(500);
         }
@@ -0,0 +1,277 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "inc/ssd1306.h"
+#include "ssd1306_emu.h"
+
+// Microbenchmarks do driver sobre o emulador. Para cada caso: tempo de CPU do host por operação (nos casos
+// que enviam ao display inclui a decodificação do emulador), bytes e transações no barramento por operação
+// e o tempo de barramento equivalente na velocidade da porta. Os casos que enviam ao display conferem a GDDRAM
+// emulada com o framebuffer ao final; uma divergência encerra com código 1.
+//
+// Uso: ssd1306_bench [diretório]   (com um diretório, grava a tela final de cada caso como <nome>.pbm)
+
+static ssd1306_frame_t frame;
+static struct render_area frame_area = {
+    .start_column = 0, .end_column = ssd1306_width - 1,
+    .start_page = 0, .end_page = ssd1306_n_pages - 1
+};
+
+static ssd1306_t bitmap_display;
+static uint8_t bitmap[ssd1306_buffer_length];
+static uint8_t icon[16 * 2];
+
+static ssd1306_frame_t fast_frame;
+static ssd1306_display_t fast_display;
+
+// Instância mais estreita que o framebuffer (96 colunas), no segundo endereço do i2c0
+#define narrow_width 96
+#define narrow_address 0x3D
+
+static ssd1306_frame_t narrow_frame;
+static ssd1306_display_t narrow_display;
+
+static int counter;
+
+// Casos de desenho (apenas CPU)
+static void bench_draw_string() {
+    ssd1306_draw_string(frame.buffer, 4, 16, "Som: 1.23 V");
+}
+
+static void bench_blit_string() {
+    ssd1306_blit_string(frame.buffer, 3, 21, "Som: 1.23 V", ssd1306_blit_or);
+}
+
+static void bench_draw_line() {
+    int x = counter++ % ssd1306_width;
+    ssd1306_draw_line(frame.buffer, x, 0, ssd1306_width - 1 - x, ssd1306_height - 1, true);
+}
+
+static void bench_fill_rect() {
+    ssd1306_fill_rect(frame.buffer, 5, 41, 100, 8, true);
+}
+
+// Ícone 64x64 em RLE (512 bytes descomprimidos), com repetições e um trecho literal
+static const uint8_t rle_icon[] = {
+    0xFF, 0x00, 0xFF, 0x81, 0x07, 1, 2, 3, 4, 5, 6, 7, 8, 0xF7, 0xFF, 0xFF, 0x00,
+};
+
+static void bench_draw_rle() {
+    ssd1306_draw_rle(frame.buffer, 0, 0, 64, 8, rle_icon);
+}
+
+// Casos de envio pela instância padrão
+static void bench_render_full() {
+    ssd1306_mark_dirty(&frame_area);
+    render_frame_on_display(&frame, &frame_area);
+}
+
+static void bench_render_text() {
+    char text[20];
+
+    snprintf(text, sizeof(text), "Som: %d.%02d V", counter / 100 % 10, counter % 100);
+    counter++;
+
+    ssd1306_clear(frame.buffer);
+    ssd1306_draw_string(frame.buffer, 4, 16, text);
+    render_frame_on_display(&frame, &frame_area);
+}
+
+// Chamador antigo: escreve direto no buffer, sem as funções de desenho nem ssd1306_mark_dirty
+static void bench_render_legacy() {
+    memset(frame.buffer + counter % ssd1306_n_pages * ssd1306_width, counter * 37, ssd1306_width);
+    counter++;
+    render_on_display(frame.buffer, &frame_area);
+}
+
+static void bench_render_unchanged() {
+    render_frame_on_display(&frame, &frame_area);
+}
+
+static void bench_render_async() {
+    ssd1306_invert_rect(frame.buffer, 5, 41, counter++ % 100 + 1, 8);
+    render_on_display_async(frame.buffer, &frame_area, NULL, NULL);
+}
+
+// Campo de texto: valor alterado a cada operação (só os dígitos que mudam) e valor repetido
+static struct ssd1306_text_field field;
+
+static void bench_field_update() {
+    ssd1306_text_field_printf(frame.buffer, &field, "Som: %d.%02d V", counter / 100 % 10, counter % 100);
+    counter++;
+    render_frame_on_display(&frame, &frame_area);
+}
+
+static void bench_field_unchanged() {
+    ssd1306_text_field_printf(frame.buffer, &field, "Som: %d.%02d V", 1, 23);
+    render_frame_on_display(&frame, &frame_area);
+}
+
+// Console: cada linha nova rola a tela pela linha inicial e envia apenas uma página
+static struct ssd1306_console console;
+
+static void bench_console_line() {
+    ssd1306_console_printf(&console, "linha %d", counter++);
+}
+
+// Tela inteira em uma instância a 1 MHz (Fast-mode Plus), para comparar o tempo de barramento
+static void bench_display_full_fm_plus() {
+    ssd1306_fill_rect(fast_frame.buffer, 0, 0, ssd1306_width, ssd1306_height, counter++ & 1);
+    ssd1306_display_render(&fast_display);
+}
+
+// Tela inteira de uma instância estreita: cada página segue numa janela própria, já que as linhas do
+// framebuffer têm ssd1306_width bytes
+static void bench_display_narrow() {
+    ssd1306_fill_rect(narrow_frame.buffer, 0, 0, narrow_width, ssd1306_height, counter & 1);
+    ssd1306_draw_string(narrow_frame.buffer, 0, (counter++ % ssd1306_n_pages) * 8, "estreita");
+    ssd1306_display_render(&narrow_display);
+}
+
+// Casos da API de bitmap (ssd1306_t)
+static void bench_bitmap_full() {
+    ssd1306_draw_bitmap(&bitmap_display, bitmap);
+}
+
+static void bench_bitmap_window() {
+    ssd1306_draw_bitmap_window(&bitmap_display, icon, counter++ % 112, 20, 16, 16);
+}
+
+struct bench {
+    const char *name;
+    void (*run)();
+    int iterations;
+    enum { check_none, check_frame, check_fast, check_narrow, check_bitmap } check;
+};
+
+static const struct bench benches[] = {
+    {"draw_string", bench_draw_string, 200000, check_none},
+    {"blit_string", bench_blit_string, 200000, check_none},
+    {"draw_line", bench_draw_line, 200000, check_none},
+    {"fill_rect", bench_fill_rect, 200000, check_none},
+    {"draw_rle", bench_draw_rle, 200000, check_none},
+    {"render_full", bench_render_full, 5000, check_frame},
+    {"render_text", bench_render_text, 5000, check_frame},
+    {"render_legacy", bench_render_legacy, 5000, check_frame},
+    {"render_unchanged", bench_render_unchanged, 200000, check_frame},
+    {"render_async", bench_render_async, 5000, check_frame},
+    {"field_update", bench_field_update, 5000, check_frame},
+    {"field_unchanged", bench_field_unchanged, 200000, check_frame},
+    {"console_line", bench_console_line, 5000, check_frame},
+    {"display_full_fm_plus", bench_display_full_fm_plus, 5000, check_fast},
+    {"display_narrow", bench_display_narrow, 5000, check_narrow},
+    {"bitmap_full", bench_bitmap_full, 5000, check_bitmap},
+    {"bitmap_window", bench_bitmap_window, 20000, check_bitmap},
+};
+
+static uint64_t now_ns() {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// O bitmap usa o endereçamento vertical: ram_buffer guarda as páginas de cada coluna em sequência
+static bool bitmap_matches(const ssd1306_emu_panel_t *panel) {
+    for (int column = 0; column < bitmap_display.width; column++) {
+        for (int page = 0; page < bitmap_display.pages; page++) {
+            if (panel->gddram[page][column] != bitmap_display.ram_buffer[1 + column * bitmap_display.pages + page]) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Prepara os displays e buffers de um caso; cada caso começa com o emulador e o driver zerados
+static ssd1306_emu_panel_t *setup(const struct bench *bench) {
+    ssd1306_emu_reset();
+    memset(&frame, 0, sizeof(frame));
+    counter = 0;
+
+    switch (bench->check) {
+        case check_bitmap:
+            ssd1306_init_bm(&bitmap_display, ssd1306_width, ssd1306_height, false, ssd1306_i2c_address, i2c1);
+            ssd1306_config(&bitmap_display);
+            for (int i = 0; i < ssd1306_buffer_length; i++) {
+                bitmap[i] = i * 37;
+            }
+            for (int i = 0; i < (int) count_of(icon); i++) {
+                icon[i] = 0xA5 ^ i;
+            }
+            return ssd1306_emu_panel(i2c1, ssd1306_i2c_address);
+        case check_fast:
+            ssd1306_display_init(&fast_display, &fast_frame, i2c0, ssd1306_i2c_address, ssd1306_width, ssd1306_height, ssd1306_i2c_clock_fast_plus);
+            return ssd1306_emu_panel(i2c0, ssd1306_i2c_address);
+        case check_narrow:
+            ssd1306_display_init(&narrow_display, &narrow_frame, i2c0, narrow_address, narrow_width, ssd1306_height, ssd1306_i2c_clock);
+            return ssd1306_emu_panel(i2c0, narrow_address);
+        default:
+            ssd1306_init();
+            render_frame_on_display(&frame, &frame_area);
+            ssd1306_text_field_init(&field, 4, 16, 15);
+            if (bench->run == bench_console_line) {
+                ssd1306_console_init(&console, frame.buffer);
+            }
+            return ssd1306_emu_panel(i2c1, ssd1306_i2c_address);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *pbm_dir = argc > 1 ? argv[1] : NULL;
+    int failures = 0;
+
+    printf("%-22s %10s %10s %12s %10s %10s\n", "benchmark", "iterations", "ns/op", "bus bytes/op", "tx/op", "bus us/op");
+
+    for (int b = 0; b < (int) count_of(benches); b++) {
+        const struct bench *bench = &benches[b];
+        ssd1306_emu_panel_t *panel = setup(bench);
+        const struct ssd1306_emu_bus *bus = ssd1306_emu_bus_stats();
+
+        uint64_t bytes = bus->bytes;
+        uint64_t transactions = bus->transactions;
+        uint64_t bus_ns = bus->time_ns;
+        uint64_t start = now_ns();
+
+        for (int i = 0; i < bench->iterations; i++) {
+            bench->run();
+        }
+
+        uint64_t elapsed = now_ns() - start;
+        double n = bench->iterations;
+
+        printf("%-22s %10d %10.1f %12.1f %10.2f %10.1f\n", bench->name, bench->iterations, elapsed / n,
+               (bus->bytes - bytes) / n, (bus->transactions - transactions) / n, (bus->time_ns - bus_ns) / n / 1000.0);
+
+        bool matches = true;
+        if (bench->check == check_frame) {
+            matches = ssd1306_emu_matches(panel, frame.buffer, ssd1306_width, ssd1306_n_pages);
+        }
+        else if (bench->check == check_fast) {
+            matches = ssd1306_emu_matches(panel, fast_frame.buffer, ssd1306_width, ssd1306_n_pages);
+        }
+        else if (bench->check == check_narrow) {
+            matches = ssd1306_emu_matches(panel, narrow_frame.buffer, narrow_width, ssd1306_n_pages);
+        }
+        else if (bench->check == check_bitmap) {
+            matches = bitmap_matches(panel);
+        }
+
+        if (!matches) {
+            printf("%-22s GDDRAM emulada difere do framebuffer\n", bench->name);
+            failures++;
+        }
+
+        if (pbm_dir && bench->check != check_none) {
+            char path[256];
+
+            snprintf(path, sizeof(path), "%s/%s.pbm", pbm_dir, bench->name);
+            if (ssd1306_emu_write_pbm(panel, path) != 0) {
+                printf("%-22s falha ao gravar %s\n", bench->name, path);
+            }
+        }
+    }
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,355 @@
+#include <stdio.h>
+#include <string.h>
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "ssd1306_emu.h"
+
+static i2c_hw_t i2c0_hw, i2c1_hw;
+i2c_inst_t i2c0_inst = {&i2c0_hw, 100000};
+i2c_inst_t i2c1_inst = {&i2c1_hw, 100000};
+
+static ssd1306_emu_panel_t panels[ssd1306_emu_max_panels];
+static int panel_count;
+static struct ssd1306_emu_bus bus;
+
+// Quantidade de argumentos de cada comando com parâmetros (os demais têm apenas o byte do comando)
+static int ssd1306_emu_argument_count(uint8_t command) {
+    switch (command) {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+        case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+// Aplica um comando completo (com seus argumentos) aos registradores do painel
+static void ssd1306_emu_execute(ssd1306_emu_panel_t *panel) {
+    uint8_t command = panel->command;
+    uint8_t *argument = panel->arguments;
+
+    panel->commands++;
+
+    if (command >= 0x40 && command <= 0x7F) {
+        panel->start_line = command & 0x3F;
+    }
+    else if (command <= 0x0F) {
+        panel->column = (panel->column & 0xF0) | command;
+    }
+    else if (command >= 0x10 && command <= 0x1F) {
+        panel->column = (panel->column & 0x0F) | ((command & 0x0F) << 4);
+    }
+    else if (command >= 0xB0 && command <= 0xB7) {
+        panel->page = command & 0x07;
+    }
+    else switch (command) {
+        case 0x20:
+            panel->memory_mode = argument[0] & 0x03;
+            break;
+        case 0x21:
+            panel->start_column = argument[0] & 0x7F;
+            panel->end_column = argument[1] & 0x7F;
+            panel->column = panel->start_column;
+            break;
+        case 0x22:
+            panel->start_page = argument[0] & 0x07;
+            panel->end_page = argument[1] & 0x07;
+            panel->page = panel->start_page;
+            break;
+        case 0xA8:
+            panel->mux_ratio = argument[0] & 0x3F;
+            break;
+        case 0xA6: case 0xA7:
+            panel->inverted = command & 0x01;
+            break;
+        case 0xAE: case 0xAF:
+            panel->display_on = command & 0x01;
+            break;
+        case 0x2E: case 0x2F:
+            panel->scrolling = command & 0x01;
+            break;
+    }
+}
+
+// Recebe um byte de comando ou argumento
+static void ssd1306_emu_command_byte(ssd1306_emu_panel_t *panel, uint8_t byte) {
+    if (panel->pending_arguments > 0) {
+        panel->arguments[panel->received_arguments++] = byte;
+        if (--panel->pending_arguments == 0) {
+            ssd1306_emu_execute(panel);
+        }
+        return;
+    }
+
+    panel->command = byte;
+    panel->received_arguments = 0;
+    panel->pending_arguments = ssd1306_emu_argument_count(byte);
+    if (panel->pending_arguments == 0) {
+        ssd1306_emu_execute(panel);
+    }
+}
+
+// Escreve um byte na GDDRAM e avança os ponteiros conforme o modo de endereçamento
+static void ssd1306_emu_data_byte(ssd1306_emu_panel_t *panel, uint8_t byte) {
+    panel->gddram[panel->page][panel->column] = byte;
+    panel->data_bytes++;
+
+    switch (panel->memory_mode) {
+        case 0: // Horizontal: coluna a coluna, depois a próxima página da janela
+            if (panel->column++ >= panel->end_column) {
+                panel->column = panel->start_column;
+                panel->page = panel->page >= panel->end_page ? panel->start_page : panel->page + 1;
+            }
+            break;
+        case 1: // Vertical: página a página, depois a próxima coluna da janela
+            if (panel->page++ >= panel->end_page) {
+                panel->page = panel->start_page;
+                panel->column = panel->column >= panel->end_column ? panel->start_column : panel->column + 1;
+            }
+            break;
+        default: // Página: apenas a coluna avança, voltando ao início da janela
+            if (panel->column++ >= panel->end_column) {
+                panel->column = panel->start_column;
+            }
+            break;
+    }
+}
+
+// Decodifica uma transação: cada byte de controle indica comando (D/C# = 0) ou dados (D/C# = 1);
+// com Co = 1 vale apenas para o byte seguinte, com Co = 0 para o restante da transação
+static void ssd1306_emu_transaction(i2c_inst_t *i2c, uint8_t address, const uint8_t *src, size_t length) {
+    ssd1306_emu_panel_t *panel = ssd1306_emu_panel(i2c, address);
+    size_t i = 0;
+
+    // START, endereço e STOP, além de 9 bits por byte (com o ACK)
+    bus.transactions++;
+    bus.bytes += length;
+    bus.time_ns += (uint64_t) ((length + 1) * 9 + 2) * 1000000000u / i2c->baudrate;
+
+    panel->transactions++;
+    panel->bytes += length;
+
+    while (i < length) {
+        uint8_t control = src[i++];
+        bool data = control & 0x40;
+
+        if (control & 0x80) {
+            if (i < length) {
+                data ? ssd1306_emu_data_byte(panel, src[i]) : ssd1306_emu_command_byte(panel, src[i]);
+                i++;
+            }
+            continue;
+        }
+
+        for (; i < length; i++) {
+            data ? ssd1306_emu_data_byte(panel, src[i]) : ssd1306_emu_command_byte(panel, src[i]);
+        }
+    }
+}
+
+// Descarta todos os painéis e zera o barramento e o relógio virtual
+void ssd1306_emu_reset() {
+    memset(panels, 0, sizeof(panels));
+    panel_count = 0;
+    memset(&bus, 0, sizeof(bus));
+}
+
+// Painel na porta e endereço dados, criado (com a GDDRAM zerada) no primeiro acesso
+ssd1306_emu_panel_t *ssd1306_emu_panel(i2c_inst_t *i2c, uint8_t address) {
+    for (int i = 0; i < panel_count; i++) {
+        if (panels[i].i2c == i2c && panels[i].address == address) {
+            return &panels[i];
+        }
+    }
+
+    assert(panel_count < ssd1306_emu_max_panels);
+
+    ssd1306_emu_panel_t *panel = &panels[panel_count++];
+    panel->i2c = i2c;
+    panel->address = address;
+    panel->end_column = ssd1306_emu_columns - 1;
+    panel->end_page = ssd1306_emu_pages - 1;
+    panel->memory_mode = 2;
+    panel->mux_ratio = 63;
+
+    return panel;
+}
+
+// Contadores de todo o barramento emulado
+const struct ssd1306_emu_bus *ssd1306_emu_bus_stats() {
+    return &bus;
+}
+
+// Pixel visível na linha y do painel, considerando a linha inicial e a inversão
+bool ssd1306_emu_pixel(const ssd1306_emu_panel_t *panel, int x, int y) {
+    if (!panel->display_on) {
+        return false;
+    }
+
+    int row = (y + panel->start_line) % 64;
+    bool lit = (panel->gddram[row / 8][x] >> (row % 8)) & 1;
+
+    return lit != panel->inverted;
+}
+
+// Compara a GDDRAM com um framebuffer no layout de ssd1306_frame_t (width colunas, pages páginas)
+bool ssd1306_emu_matches(const ssd1306_emu_panel_t *panel, const uint8_t *ssd, int width, int pages) {
+    for (int page = 0; page < pages; page++) {
+        if (memcmp(panel->gddram[page], ssd + page * ssd1306_emu_columns, width) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Grava a tela visível como PBM binário (P4), com os pixels acesos em preto. Retorna 0 em caso de sucesso
+int ssd1306_emu_write_pbm(const ssd1306_emu_panel_t *panel, const char *path) {
+    FILE *file = fopen(path, "wb");
+    int height = panel->mux_ratio + 1;
+
+    if (!file) {
+        return -1;
+    }
+
+    fprintf(file, "P4\n%d %d\n", ssd1306_emu_columns, height);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < ssd1306_emu_columns; x += 8) {
+            uint8_t bits = 0;
+
+            for (int bit = 0; bit < 8; bit++) {
+                bits = (bits << 1) | ssd1306_emu_pixel(panel, x + bit, y);
+            }
+            fputc(bits, file);
+        }
+    }
+
+    return fclose(file);
+}
+
+// Relógio virtual: tempo acumulado de barramento
+uint64_t time_us_64(void) {
+    return bus.time_ns / 1000;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t) time_us_64();
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    return i2c_set_baudrate(i2c, baudrate);
+}
+
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate) {
+    i2c->baudrate = baudrate;
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void) nostop;
+
+    ssd1306_emu_transaction(i2c, addr, src, len);
+    return (int) len;
+}
+
+// DMA: um único canal, cujo destino é o IC_DATA_CMD de uma das portas
+static volatile void *dma_write_addr;
+static irq_handler_t irq_handlers[32];
+
+int dma_claim_unused_channel(bool required) {
+    (void) required;
+    return 0;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void) channel;
+    dma_channel_config config = {0};
+    return config;
+}
+
+void dma_channel_set_config(uint channel, const dma_channel_config *config, bool trigger) {
+    (void) channel;
+    (void) config;
+    (void) trigger;
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger) {
+    (void) channel;
+    (void) trigger;
+    dma_write_addr = write_addr;
+}
+
+// Decodifica a fila de palavras do IC_DATA_CMD: RESTART abre uma nova transação e STOP encerra a última.
+// Ao fim, sinaliza STOP_DET e chama a interrupção da porta, como o hardware faria
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+    (void) channel;
+
+    i2c_inst_t *i2c = dma_write_addr == &i2c0_hw.data_cmd ? i2c0 : i2c1;
+    const volatile uint16_t *words = read_addr;
+    static uint8_t transaction[2048];
+    size_t length = 0;
+
+    for (uint32_t i = 0; i < transfer_count; i++) {
+        if ((words[i] & I2C_IC_DATA_CMD_RESTART_BITS) && length > 0) {
+            ssd1306_emu_transaction(i2c, i2c->hw->tar, transaction, length);
+            length = 0;
+        }
+
+        assert(length < sizeof(transaction));
+        transaction[length++] = words[i] & 0xFF;
+
+        if (words[i] & I2C_IC_DATA_CMD_STOP_BITS) {
+            ssd1306_emu_transaction(i2c, i2c->hw->tar, transaction, length);
+            length = 0;
+        }
+    }
+
+    *(io_rw_32 *) &i2c->hw->intr_stat = I2C_IC_INTR_STAT_R_STOP_DET_BITS;
+    if ((i2c->hw->intr_mask & I2C_IC_INTR_MASK_M_STOP_DET_BITS) && irq_handlers[I2C0_IRQ + i2c_hw_index(i2c)]) {
+        irq_handlers[I2C0_IRQ + i2c_hw_index(i2c)]();
+    }
+    *(io_rw_32 *) &i2c->hw->intr_stat = 0;
+}
+
+bool dma_channel_is_busy(uint channel) {
+    (void) channel;
+    return false;
+}
+
+void dma_channel_abort(uint channel) {
+    (void) channel;
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+    irq_handlers[num] = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+    (void) num;
+    (void) enabled;
+}
+
+static spin_lock_t spin_locks[32];
+
+int spin_lock_claim_unused(bool required) {
+    (void) required;
+    return 0;
+}
+
+spin_lock_t *spin_lock_instance(uint lock_num) {
+    return &spin_locks[lock_num];
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    (void) entry;
+}
@@ -0,0 +1,60 @@
+#ifndef ssd1306_emu_h
+#define ssd1306_emu_h
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+// Emulador do SSD1306 para host: as escritas no i2c (bloqueantes ou pela fila do DMA) são decodificadas
+// como o controlador faria, atualizando a GDDRAM e os registradores de um painel emulado por porta e endereço.
+// O tempo de barramento de cada transação (9 bits por byte, mais START/STOP) avança um relógio virtual,
+// que é o que time_us_32 retorna ao driver
+
+#define ssd1306_emu_max_panels 4
+#define ssd1306_emu_pages 8
+#define ssd1306_emu_columns 128
+
+typedef struct {
+    i2c_inst_t *i2c;
+    uint8_t address;
+
+    uint8_t gddram[ssd1306_emu_pages][ssd1306_emu_columns];
+
+    // Endereçamento: modo (0 horizontal, 1 vertical, 2 página), janela e ponteiros atuais
+    uint8_t memory_mode;
+    uint8_t start_column, end_column, column;
+    uint8_t start_page, end_page, page;
+
+    uint8_t start_line;
+    uint8_t mux_ratio;
+    bool display_on;
+    bool inverted;
+    bool scrolling;
+
+    // Comando em decodificação (argumentos podem chegar em outra transação)
+    uint8_t command;
+    uint8_t arguments[6];
+    int pending_arguments;
+    int received_arguments;
+
+    // Tráfego recebido
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t commands;
+    uint32_t data_bytes;
+} ssd1306_emu_panel_t;
+
+// Contadores de todo o barramento emulado (as duas portas)
+struct ssd1306_emu_bus {
+    uint64_t transactions;
+    uint64_t bytes;
+    uint64_t time_ns;
+};
+
+void ssd1306_emu_reset();
+ssd1306_emu_panel_t *ssd1306_emu_panel(i2c_inst_t *i2c, uint8_t address);
+const struct ssd1306_emu_bus *ssd1306_emu_bus_stats();
+bool ssd1306_emu_pixel(const ssd1306_emu_panel_t *panel, int x, int y);
+bool ssd1306_emu_matches(const ssd1306_emu_panel_t *panel, const uint8_t *ssd, int width, int pages);
+int ssd1306_emu_write_pbm(const ssd1306_emu_panel_t *panel, const char *path);
+
+#endif
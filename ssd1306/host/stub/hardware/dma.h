@@ -0,0 +1,33 @@
+// Versão para host do hardware/dma.h: a transferência é decodificada de imediato pelo emulador
+#ifndef _HARDWARE_DMA_H
+#define _HARDWARE_DMA_H
+
+#include "pico/stdlib.h"
+
+enum dma_channel_transfer_size {
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+typedef struct {
+    uint32_t ctrl;
+} dma_channel_config;
+
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(uint channel);
+void dma_channel_set_config(uint channel, const dma_channel_config *config, bool trigger);
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger);
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_abort(uint channel);
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+    c->ctrl = (c->ctrl & ~3u) | size;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) { (void) c; (void) incr; }
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) { (void) c; (void) incr; }
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) { (void) c; (void) dreq; }
+
+#endif
@@ -0,0 +1,48 @@
+// Versão para host do hardware/i2c.h: as escritas vão para os painéis emulados em ssd1306_emu.c
+#ifndef _HARDWARE_I2C_H
+#define _HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+
+// Apenas os registradores usados pelo envio assíncrono do driver
+typedef struct {
+    io_rw_32 enable;
+    io_rw_32 tar;
+    io_rw_32 data_cmd;
+    io_rw_32 intr_mask;
+    io_rw_32 dma_tdlr;
+    io_ro_32 intr_stat;
+    io_ro_32 clr_tx_abrt;
+    io_ro_32 clr_stop_det;
+} i2c_hw_t;
+
+typedef struct i2c_inst {
+    i2c_hw_t *hw;
+    uint baudrate;
+} i2c_inst_t;
+
+extern i2c_inst_t i2c0_inst;
+extern i2c_inst_t i2c1_inst;
+
+#define i2c0 (&i2c0_inst)
+#define i2c1 (&i2c1_inst)
+
+#define I2C_IC_DATA_CMD_RESTART_BITS _u(0x00000400)
+#define I2C_IC_DATA_CMD_STOP_BITS _u(0x00000200)
+#define I2C_IC_INTR_STAT_R_TX_ABRT_BITS _u(0x00000040)
+#define I2C_IC_INTR_STAT_R_STOP_DET_BITS _u(0x00000200)
+#define I2C_IC_INTR_MASK_M_TX_ABRT_BITS _u(0x00000040)
+#define I2C_IC_INTR_MASK_M_STOP_DET_BITS _u(0x00000200)
+
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) { return i2c->hw; }
+static inline uint i2c_hw_index(i2c_inst_t *i2c) { return i2c == i2c1 ? 1 : 0; }
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) { return i2c_hw_index(i2c) * 2 + (is_tx ? 0 : 1); }
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+#endif
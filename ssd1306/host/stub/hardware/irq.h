@@ -0,0 +1,17 @@
+// Versão para host do hardware/irq.h: o emulador chama o handler do i2c ao fim de cada envio por DMA
+#ifndef _HARDWARE_IRQ_H
+#define _HARDWARE_IRQ_H
+
+#include "pico/stdlib.h"
+
+typedef void (*irq_handler_t)(void);
+
+enum irq_num_rp2040 {
+    I2C0_IRQ = 23,
+    I2C1_IRQ = 24,
+};
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
+
+#endif
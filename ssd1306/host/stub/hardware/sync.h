@@ -0,0 +1,17 @@
+// Versão para host do hardware/sync.h: execução em uma única thread, travas sem efeito
+#ifndef _HARDWARE_SYNC_H
+#define _HARDWARE_SYNC_H
+
+#include "pico/stdlib.h"
+
+typedef volatile uint32_t spin_lock_t;
+
+int spin_lock_claim_unused(bool required);
+spin_lock_t *spin_lock_instance(uint lock_num);
+
+static inline uint32_t spin_lock_blocking(spin_lock_t *lock) { (void) lock; return 0; }
+static inline void spin_unlock(spin_lock_t *lock, uint32_t saved_irq) { (void) lock; (void) saved_irq; }
+static inline void __sev(void) {}
+static inline void __wfe(void) {}
+
+#endif
@@ -0,0 +1,8 @@
+// Versão para host do pico/binary_info.h (sem efeito fora do RP2040)
+#ifndef _PICO_BINARY_INFO_H
+#define _PICO_BINARY_INFO_H
+
+#define bi_decl(...)
+#define bi_2pins_with_func(...)
+
+#endif
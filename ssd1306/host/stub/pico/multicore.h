@@ -0,0 +1,9 @@
+// Versão para host do pico/multicore.h: não há núcleo 1, a função de entrada nunca é executada
+#ifndef _PICO_MULTICORE_H
+#define _PICO_MULTICORE_H
+
+#include "pico/stdlib.h"
+
+void multicore_launch_core1(void (*entry)(void));
+
+#endif
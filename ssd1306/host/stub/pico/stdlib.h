@@ -0,0 +1,24 @@
+// Versão para host (Linux) do pico/stdlib.h: apenas o que o driver do SSD1306 utiliza
+#ifndef _PICO_STDLIB_H
+#define _PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <assert.h>
+
+#define _u(x) x ## u
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+typedef unsigned int uint;
+
+static inline void tight_loop_contents(void) {}
+static inline uint get_core_num(void) { return 0; }
+static inline void sleep_ms(uint32_t ms) { (void) ms; }
+static inline void sleep_us(uint64_t us) { (void) us; }
+
+// Relógio virtual do emulador: avança com o tempo de barramento das transações i2c (ver ssd1306_emu.c)
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+
+#endif
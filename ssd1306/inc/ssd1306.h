@@ -0,0 +1,59 @@
+#include "ssd1306_i2c.h"
+extern void calculate_render_area_buffer_length(struct render_area *area);
+extern void ssd1306_send_command(uint8_t cmd);
+extern void ssd1306_send_command_list(uint8_t *ssd, int number);
+extern void ssd1306_send_buffer(uint8_t ssd[], int buffer_length);
+extern void ssd1306_init();
+extern void ssd1306_scroll(bool set);
+extern void render_on_display(uint8_t *ssd, struct render_area *area);
+extern void render_frame_on_display(ssd1306_frame_t *frame, struct render_area *area);
+extern bool render_on_display_async(uint8_t *ssd, struct render_area *area, ssd1306_async_callback_t callback, void *user_data);
+extern bool ssd1306_async_busy();
+extern void ssd1306_async_wait();
+extern void ssd1306_set_wait_hook(ssd1306_wait_hook_t wait, ssd1306_owner_hook_t owner);
+extern void ssd1306_display_init(ssd1306_display_t *display, ssd1306_frame_t *frame, i2c_inst_t *i2c, uint8_t address, uint8_t width, uint8_t height, uint32_t bus_khz);
+extern void ssd1306_display_set_bus_speed(ssd1306_display_t *display, uint32_t bus_khz);
+extern void ssd1306_display_render(ssd1306_display_t *display);
+extern bool ssd1306_display_render_async(ssd1306_display_t *display, ssd1306_async_callback_t callback, void *user_data);
+extern const struct ssd1306_flush_stats *ssd1306_display_flush_stats(ssd1306_display_t *display);
+extern const struct ssd1306_bus_stats *ssd1306_display_bus_stats(ssd1306_display_t *display);
+extern void ssd1306_db_init();
+extern uint8_t *ssd1306_db_back();
+extern void ssd1306_db_publish();
+extern bool ssd1306_db_flush(ssd1306_async_callback_t callback, void *user_data);
+extern void ssd1306_db_launch_core1();
+extern void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set);
+extern void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set);
+extern void ssd1306_draw_hline(uint8_t *ssd, int x, int y, int width, bool set);
+extern void ssd1306_draw_vline(uint8_t *ssd, int x, int y, int height, bool set);
+extern void ssd1306_draw_rect(uint8_t *ssd, int x, int y, int width, int height, bool set);
+extern void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int width, int height, bool set);
+extern void ssd1306_clear_rect(uint8_t *ssd, int x, int y, int width, int height);
+extern void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int width, int height);
+extern void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character);
+extern void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string);
+extern void ssd1306_blit_char(uint8_t *ssd, int x, int y, uint8_t character, enum ssd1306_blit_mode mode);
+extern void ssd1306_blit_string(uint8_t *ssd, int x, int y, const char *string, enum ssd1306_blit_mode mode);
+extern void ssd1306_text_field_init(struct ssd1306_text_field *field, int x, int y, int columns);
+extern void ssd1306_text_field_invalidate(struct ssd1306_text_field *field);
+extern bool ssd1306_text_field_set(uint8_t *ssd, struct ssd1306_text_field *field, const char *text);
+extern bool ssd1306_text_field_printf(uint8_t *ssd, struct ssd1306_text_field *field, const char *format, ...);
+extern void ssd1306_console_init(struct ssd1306_console *console, uint8_t *ssd);
+extern void ssd1306_console_print(struct ssd1306_console *console, const char *text);
+extern void ssd1306_console_printf(struct ssd1306_console *console, const char *format, ...);
+extern void ssd1306_console_end(struct ssd1306_console *console);
+extern void ssd1306_draw_rle(uint8_t *ssd, int x, int page, int width, int pages, const uint8_t *rle);
+extern void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+extern void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, int number);
+extern void ssd1306_config(ssd1306_t *ssd);
+extern void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c);
+extern void ssd1306_send_data(ssd1306_t *ssd);
+extern void ssd1306_mark_dirty(struct render_area *area);
+extern void ssd1306_clear(uint8_t *ssd);
+extern const struct ssd1306_flush_stats *ssd1306_get_flush_stats();
+extern const struct ssd1306_bus_stats *ssd1306_get_bus_stats();
+extern void ssd1306_reset_bus_stats();
+extern void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap);
+extern void ssd1306_send_columns(ssd1306_t *ssd, uint8_t start_column, uint8_t end_column);
+extern void ssd1306_blit(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height);
+extern void ssd1306_draw_bitmap_window(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height);
\ No newline at end of file
@@ -0,0 +1,260 @@
+// Gerado por tools/ssd1306_font_gen.py (não editar manualmente)
+// Glifos 8x8 indexados diretamente pelo código do caractere (ASCII + Latin-1): font[codigo * 8]
+static const uint8_t font[256 * 8] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0000
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0001
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0002
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0003
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0004
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0005
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0006
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0007
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0008
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0009
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+000A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+000B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+000C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+000D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+000E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+000F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0010
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0011
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0012
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0013
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0014
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0015
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0016
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0017
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0018
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0019
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+001A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+001B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+001C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+001D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+001E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+001F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //  
+    0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, // !
+    0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, // "
+    0x14, 0x14, 0x7f, 0x14, 0x7f, 0x00, 0x00, 0x00, // #
+    0x24, 0x2a, 0x2a, 0x7f, 0x02, 0x10, 0x00, 0x00, // $
+    0x23, 0x13, 0x08, 0x04, 0x32, 0x31, 0x00, 0x00, // %
+    0x36, 0x49, 0x55, 0x22, 0x50, 0x00, 0x00, 0x00, // &
+    0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, // '
+    0x00, 0x00, 0x1c, 0x22, 0x41, 0x00, 0x00, 0x00, // (
+    0x00, 0x00, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x00, // )
+    0x00, 0x14, 0x08, 0x3e, 0x08, 0x14, 0x00, 0x00, // *
+    0x00, 0x08, 0x08, 0x3e, 0x08, 0x08, 0x00, 0x00, // +
+    0x00, 0x00, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, // ,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, // -
+    0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, // .
+    0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, // /
+    0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, // 0
+    0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, // 1
+    0x30, 0x49, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00, // 2
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 3
+    0x3f, 0x20, 0x20, 0x78, 0x20, 0x20, 0x00, 0x00, // 4
+    0x4f, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, // 5
+    0x3f, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x00, // 6
+    0x01, 0x01, 0x01, 0x61, 0x31, 0x0d, 0x03, 0x00, // 7
+    0x36, 0x49, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, // 8
+    0x06, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7f, 0x00, // 9
+    0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, // :
+    0x00, 0x00, 0x56, 0x36, 0x00, 0x00, 0x00, 0x00, // ;
+    0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, // <
+    0x00, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00, // =
+    0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, // >
+    0x02, 0x01, 0x01, 0x59, 0x09, 0x06, 0x00, 0x00, // ?
+    0x3e, 0x41, 0x49, 0x55, 0x55, 0x5d, 0x0e, 0x00, // @
+    0x78, 0x14, 0x12, 0x11, 0x12, 0x14, 0x78, 0x00, // A
+    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x7f, 0x00, // B
+    0x7e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x00, // C
+    0x7f, 0x41, 0x41, 0x41, 0x41, 0x41, 0x7e, 0x00, // D
+    0x7f, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, // E
+    0x7f, 0x09, 0x09, 0x09, 0x09, 0x01, 0x01, 0x00, // F
+    0x7f, 0x41, 0x41, 0x41, 0x51, 0x51, 0x73, 0x00, // G
+    0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7f, 0x00, // H
+    0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, // I
+    0x21, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x01, 0x00, // J
+    0x00, 0x7f, 0x08, 0x08, 0x14, 0x22, 0x41, 0x00, // K
+    0x7f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, // L
+    0x7f, 0x02, 0x04, 0x08, 0x04, 0x02, 0x7f, 0x00, // M
+    0x7f, 0x02, 0x04, 0x08, 0x10, 0x20, 0x7f, 0x00, // N
+    0x3e, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x00, // O
+    0x7f, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, 0x00, // P
+    0x3e, 0x41, 0x41, 0x49, 0x51, 0x61, 0x7e, 0x00, // Q
+    0x7f, 0x11, 0x11, 0x11, 0x31, 0x51, 0x0e, 0x00, // R
+    0x46, 0x49, 0x49, 0x49, 0x49, 0x30, 0x00, 0x00, // S
+    0x01, 0x01, 0x01, 0x7f, 0x01, 0x01, 0x01, 0x00, // T
+    0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3f, 0x00, // U
+    0x0f, 0x10, 0x20, 0x40, 0x20, 0x10, 0x0f, 0x00, // V
+    0x7f, 0x20, 0x10, 0x08, 0x10, 0x20, 0x7f, 0x00, // W
+    0x00, 0x41, 0x22, 0x14, 0x14, 0x22, 0x41, 0x00, // X
+    0x01, 0x02, 0x04, 0x78, 0x04, 0x02, 0x01, 0x00, // Y
+    0x41, 0x61, 0x59, 0x45, 0x43, 0x41, 0x00, 0x00, // Z
+    0x00, 0x00, 0x7f, 0x41, 0x41, 0x00, 0x00, 0x00, // [
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, // backslash
+    0x00, 0x00, 0x41, 0x41, 0x7f, 0x00, 0x00, 0x00, // ]
+    0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, // ^
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, // _
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, // `
+    0x20, 0x54, 0x54, 0x54, 0x54, 0x78, 0x00, 0x00, // a
+    0x7f, 0x28, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, // b
+    0x38, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, // c
+    0x38, 0x44, 0x44, 0x44, 0x28, 0x7f, 0x00, 0x00, // d
+    0x38, 0x54, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, // e
+    0x00, 0x04, 0x7e, 0x05, 0x05, 0x00, 0x00, 0x00, // f
+    0x18, 0xa4, 0xa4, 0xa4, 0xa4, 0x7c, 0x00, 0x00, // g
+    0x7f, 0x08, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00, // h
+    0x00, 0x00, 0x44, 0x7d, 0x40, 0x00, 0x00, 0x00, // i
+    0x40, 0x80, 0x80, 0x84, 0x7d, 0x00, 0x00, 0x00, // j
+    0x7f, 0x10, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, // k
+    0x00, 0x00, 0x41, 0x7f, 0x40, 0x00, 0x00, 0x00, // l
+    0x7c, 0x04, 0x78, 0x04, 0x78, 0x00, 0x00, 0x00, // m
+    0x7c, 0x08, 0x04, 0x04, 0x04, 0x78, 0x00, 0x00, // n
+    0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, // o
+    0xfc, 0x28, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, // p
+    0x18, 0x24, 0x24, 0x24, 0x28, 0xfc, 0x00, 0x00, // q
+    0x7c, 0x08, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, // r
+    0x48, 0x54, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00, // s
+    0x04, 0x04, 0x3f, 0x44, 0x44, 0x00, 0x00, 0x00, // t
+    0x3c, 0x40, 0x40, 0x40, 0x20, 0x7c, 0x00, 0x00, // u
+    0x0c, 0x30, 0x40, 0x40, 0x30, 0x0c, 0x00, 0x00, // v
+    0x3c, 0x40, 0x20, 0x10, 0x20, 0x40, 0x3c, 0x00, // w
+    0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, // x
+    0x1c, 0xa0, 0xa0, 0xa0, 0xa0, 0x7c, 0x00, 0x00, // y
+    0x44, 0x64, 0x54, 0x4c, 0x44, 0x00, 0x00, 0x00, // z
+    0x00, 0x00, 0x08, 0x36, 0x41, 0x41, 0x00, 0x00, // {
+    0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, // |
+    0x00, 0x41, 0x41, 0x36, 0x08, 0x00, 0x00, 0x00, // }
+    0x08, 0x04, 0x04, 0x08, 0x08, 0x04, 0x00, 0x00, // ~
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+007F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0080
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0081
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0082
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0083
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0084
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0085
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0086
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0087
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0088
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0089
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+008A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+008B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+008C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+008D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+008E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+008F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0090
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0091
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0092
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0093
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0094
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0095
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0096
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0097
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0098
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+0099
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+009A
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+009B
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+009C
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+009D
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+009E
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // U+009F
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // NBSP
+    0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, // ¡
+    0x1c, 0x22, 0x22, 0x7f, 0x22, 0x00, 0x00, 0x00, // ¢
+    0x48, 0x7e, 0x49, 0x49, 0x41, 0x42, 0x00, 0x00, // £
+    0x42, 0x3c, 0x24, 0x24, 0x3c, 0x42, 0x00, 0x00, // ¤
+    0x01, 0x2a, 0x2c, 0x78, 0x2c, 0x2a, 0x01, 0x00, // ¥
+    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, // ¦
+    0x4a, 0x55, 0x55, 0x29, 0x00, 0x00, 0x00, 0x00, // §
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, // ¨
+    0x3e, 0x41, 0x5d, 0x55, 0x55, 0x41, 0x3e, 0x00, // ©
+    0x48, 0x55, 0x55, 0x5f, 0x00, 0x00, 0x00, 0x00, // ª
+    0x00, 0x08, 0x14, 0x22, 0x08, 0x14, 0x22, 0x00, // «
+    0x04, 0x04, 0x04, 0x04, 0x04, 0x1c, 0x00, 0x00, // ¬
+    0x00, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, // ­
+    0x3e, 0x41, 0x7d, 0x55, 0x69, 0x41, 0x3e, 0x00, // ®
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, // ¯
+    0x00, 0x02, 0x05, 0x05, 0x02, 0x00, 0x00, 0x00, // °
+    0x00, 0x44, 0x44, 0x5f, 0x44, 0x44, 0x00, 0x00, // ±
+    0x00, 0x09, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, // ²
+    0x00, 0x09, 0x0b, 0x06, 0x00, 0x00, 0x00, 0x00, // ³
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, // ´
+    0xfc, 0x20, 0x40, 0x40, 0x40, 0x3c, 0x00, 0x00, // µ
+    0x06, 0x0f, 0x0f, 0x71, 0x0f, 0x71, 0x00, 0x00, // ¶
+    0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, // ·
+    0x00, 0x80, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, // ¸
+    0x00, 0x0a, 0x0f, 0x08, 0x00, 0x00, 0x00, 0x00, // ¹
+    0x26, 0x29, 0x29, 0x26, 0x00, 0x00, 0x00, 0x00, // º
+    0x22, 0x14, 0x08, 0x22, 0x14, 0x08, 0x00, 0x00, // »
+    0x42, 0x27, 0x10, 0x28, 0x34, 0x7a, 0x01, 0x00, // ¼
+    0x42, 0x27, 0x10, 0x08, 0x54, 0x72, 0x01, 0x00, // ½
+    0x45, 0x2f, 0x18, 0x20, 0x3c, 0x72, 0x09, 0x00, // ¾
+    0x20, 0x50, 0x48, 0x45, 0x40, 0x20, 0x00, 0x00, // ¿
+    0x70, 0x18, 0x14, 0x15, 0x16, 0x18, 0x70, 0x00, // À
+    0x70, 0x18, 0x14, 0x16, 0x15, 0x18, 0x70, 0x00, // Á
+    0x70, 0x18, 0x16, 0x15, 0x16, 0x18, 0x70, 0x00, // Â
+    0x70, 0x18, 0x16, 0x15, 0x16, 0x19, 0x70, 0x00, // Ã
+    0x70, 0x19, 0x14, 0x14, 0x14, 0x19, 0x70, 0x00, // Ä
+    0x70, 0x18, 0x15, 0x16, 0x15, 0x18, 0x70, 0x00, // Å
+    0x7c, 0x0a, 0x09, 0x7f, 0x49, 0x49, 0x41, 0x00, // Æ
+    0x38, 0x44, 0xc4, 0xc4, 0x44, 0x44, 0x44, 0x00, // Ç
+    0x7c, 0x54, 0x54, 0x55, 0x56, 0x44, 0x44, 0x00, // È
+    0x7c, 0x54, 0x54, 0x56, 0x55, 0x44, 0x44, 0x00, // É
+    0x7c, 0x54, 0x56, 0x55, 0x56, 0x44, 0x44, 0x00, // Ê
+    0x7c, 0x55, 0x54, 0x54, 0x54, 0x45, 0x44, 0x00, // Ë
+    0x00, 0x00, 0x44, 0x7d, 0x46, 0x00, 0x00, 0x00, // Ì
+    0x00, 0x00, 0x44, 0x7e, 0x45, 0x00, 0x00, 0x00, // Í
+    0x00, 0x00, 0x46, 0x7d, 0x46, 0x00, 0x00, 0x00, // Î
+    0x00, 0x01, 0x44, 0x7c, 0x44, 0x01, 0x00, 0x00, // Ï
+    0x49, 0x7f, 0x49, 0x49, 0x41, 0x41, 0x3e, 0x00, // Ð
+    0x7c, 0x04, 0x0a, 0x11, 0x22, 0x41, 0x7c, 0x00, // Ñ
+    0x38, 0x44, 0x44, 0x45, 0x46, 0x44, 0x38, 0x00, // Ò
+    0x38, 0x44, 0x44, 0x46, 0x45, 0x44, 0x38, 0x00, // Ó
+    0x38, 0x44, 0x46, 0x45, 0x46, 0x44, 0x38, 0x00, // Ô
+    0x38, 0x44, 0x46, 0x45, 0x46, 0x45, 0x38, 0x00, // Õ
+    0x38, 0x45, 0x44, 0x44, 0x44, 0x45, 0x38, 0x00, // Ö
+    0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, // ×
+    0x7e, 0x21, 0x51, 0x49, 0x45, 0x43, 0x7e, 0x01, // Ø
+    0x3c, 0x40, 0x40, 0x41, 0x42, 0x40, 0x3c, 0x00, // Ù
+    0x3c, 0x40, 0x40, 0x42, 0x41, 0x40, 0x3c, 0x00, // Ú
+    0x3c, 0x40, 0x42, 0x41, 0x42, 0x40, 0x3c, 0x00, // Û
+    0x3c, 0x41, 0x40, 0x40, 0x40, 0x41, 0x3c, 0x00, // Ü
+    0x04, 0x08, 0x10, 0x72, 0x11, 0x08, 0x04, 0x00, // Ý
+    0x7f, 0x12, 0x12, 0x12, 0x12, 0x0c, 0x00, 0x00, // Þ
+    0x7e, 0x01, 0x49, 0x4d, 0x32, 0x00, 0x00, 0x00, // ß
+    0x20, 0x54, 0x55, 0x56, 0x54, 0x78, 0x00, 0x00, // à
+    0x20, 0x54, 0x56, 0x55, 0x54, 0x78, 0x00, 0x00, // á
+    0x20, 0x56, 0x55, 0x56, 0x54, 0x78, 0x00, 0x00, // â
+    0x20, 0x56, 0x55, 0x56, 0x55, 0x78, 0x00, 0x00, // ã
+    0x21, 0x54, 0x54, 0x54, 0x55, 0x78, 0x00, 0x00, // ä
+    0x20, 0x55, 0x56, 0x55, 0x54, 0x78, 0x00, 0x00, // å
+    0x20, 0x54, 0x54, 0x38, 0x54, 0x54, 0x58, 0x00, // æ
+    0x38, 0x44, 0xc4, 0xc4, 0x44, 0x00, 0x00, 0x00, // ç
+    0x38, 0x54, 0x55, 0x56, 0x54, 0x18, 0x00, 0x00, // è
+    0x38, 0x54, 0x56, 0x55, 0x54, 0x18, 0x00, 0x00, // é
+    0x38, 0x56, 0x55, 0x56, 0x54, 0x18, 0x00, 0x00, // ê
+    0x39, 0x54, 0x54, 0x54, 0x55, 0x18, 0x00, 0x00, // ë
+    0x00, 0x00, 0x44, 0x7d, 0x42, 0x00, 0x00, 0x00, // ì
+    0x00, 0x00, 0x44, 0x7e, 0x41, 0x00, 0x00, 0x00, // í
+    0x00, 0x00, 0x46, 0x7d, 0x42, 0x00, 0x00, 0x00, // î
+    0x00, 0x01, 0x44, 0x7c, 0x40, 0x01, 0x00, 0x00, // ï
+    0x20, 0x55, 0x52, 0x55, 0x50, 0x38, 0x00, 0x00, // ð
+    0x7c, 0x0a, 0x05, 0x06, 0x05, 0x78, 0x00, 0x00, // ñ
+    0x38, 0x44, 0x45, 0x46, 0x44, 0x38, 0x00, 0x00, // ò
+    0x38, 0x44, 0x46, 0x45, 0x44, 0x38, 0x00, 0x00, // ó
+    0x38, 0x46, 0x45, 0x46, 0x44, 0x38, 0x00, 0x00, // ô
+    0x38, 0x46, 0x45, 0x46, 0x45, 0x38, 0x00, 0x00, // õ
+    0x39, 0x44, 0x44, 0x44, 0x45, 0x38, 0x00, 0x00, // ö
+    0x00, 0x08, 0x08, 0x2a, 0x08, 0x08, 0x00, 0x00, // ÷
+    0x78, 0x24, 0x44, 0x54, 0x4c, 0x78, 0x04, 0x00, // ø
+    0x3c, 0x40, 0x41, 0x42, 0x20, 0x7c, 0x00, 0x00, // ù
+    0x3c, 0x40, 0x42, 0x41, 0x20, 0x7c, 0x00, 0x00, // ú
+    0x3c, 0x42, 0x41, 0x42, 0x20, 0x7c, 0x00, 0x00, // û
+    0x3d, 0x40, 0x40, 0x40, 0x21, 0x7c, 0x00, 0x00, // ü
+    0x1c, 0xa0, 0xa2, 0xa1, 0xa0, 0x7c, 0x00, 0x00, // ý
+    0xfe, 0x28, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, // þ
+    0x1d, 0xa0, 0xa0, 0xa0, 0xa1, 0x7c, 0x00, 0x00, // ÿ
+};
@@ -0,0 +1,1561 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "pico/binary_info.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "ssd1306_font.h"
+#include "ssd1306_i2c.h"
+
+// Instância usada pela API sem handle (render_on_display, ssd1306_send_command, ...), configurada por
+// ssd1306_init: i2c1, endereço 0x3C, 128x64 a 400 kHz. Buffers que não pertencem a nenhuma instância
+// registrada são atribuídos a ela
+static ssd1306_display_t default_display;
+
+// Instâncias criadas com ssd1306_display_init, cada uma dona do seu framebuffer
+static ssd1306_display_t *displays[ssd1306_max_displays];
+static int display_count;
+
+// Velocidade atual de cada porta i2c (0 = ainda não ajustada pelo driver)
+static uint32_t port_khz[2];
+
+// Esvazia todas as páginas de um conjunto de faixas
+static inline void ssd1306_spans_reset(struct ssd1306_page_spans *spans) {
+    memset(spans->start_column, ssd1306_width - 1, sizeof(spans->start_column));
+    memset(spans->end_column, 0, sizeof(spans->end_column));
+}
+
+// Marca todas as colunas de todas as páginas em um conjunto de faixas
+static inline void ssd1306_spans_fill(struct ssd1306_page_spans *spans) {
+    memset(spans->start_column, 0, sizeof(spans->start_column));
+    memset(spans->end_column, ssd1306_width - 1, sizeof(spans->end_column));
+}
+
+// Acrescenta as colunas [start_column, end_column] de uma página a um conjunto de faixas
+static inline void ssd1306_spans_add(struct ssd1306_page_spans *spans, int page, int start_column, int end_column) {
+    if (start_column < spans->start_column[page]) spans->start_column[page] = start_column;
+    if (end_column > spans->end_column[page]) spans->end_column[page] = end_column;
+}
+
+// Instância dona de um framebuffer, cujas faixas alteradas devem ser marcadas ao desenhar nele
+static inline ssd1306_display_t *ssd1306_owner(const uint8_t *ssd) {
+    for (int i = 0; i < display_count; i++) {
+        if (displays[i]->frame->buffer == ssd) {
+            return displays[i];
+        }
+    }
+
+    return &default_display;
+}
+
+// Fila de palavras para o IC_DATA_CMD, consumida pelo DMA no envio assíncrono. Escritas de 8 bits seriam
+// replicadas nos bits de controle do registrador, por isso cada byte vira uma palavra de 16 bits. Há uma
+// única fila para todas as instâncias: um envio assíncrono por vez
+static uint16_t async_words[ssd1306_async_max_words];
+static int async_length;
+static bool async_overflow; // Uma transação não coube na fila: o envio é descartado
+static int async_dma_channel = -1;
+static dma_channel_config async_dma_config;
+static volatile bool async_busy;
+static ssd1306_display_t *async_display;
+static ssd1306_async_callback_t async_callback;
+static void *async_user_data;
+
+// Posse do barramento: um envio assíncrono (async_busy) ou uma sequência de escritas bloqueantes de um dono
+// (bus_depth, aninhável para o mesmo dono). Verificada e tomada sob bus_lock, para que o núcleo 1 (modo de buffer
+// duplo) não dispare o DMA entre a verificação e a escrita do outro núcleo
+static spin_lock_t *bus_lock;
+static void *bus_owner;
+static int bus_depth;
+
+// Espera do driver pelo barramento e identidade de quem o toma (ver ssd1306_set_wait_hook)
+static ssd1306_wait_hook_t wait_hook;
+static ssd1306_owner_hook_t owner_hook;
+
+// Define a função chamada enquanto o driver espera pelo barramento, em vez do __wfe padrão, e a que identifica
+// quem o toma, em vez do núcleo. Sob o FreeRTOS, wait pode bloquear a tarefa por um tick (vTaskDelay(1)) e
+// owner deve retornar a tarefa atual (xTaskGetCurrentTaskHandle): no SMP uma tarefa muda de núcleo no meio de
+// um envio, e duas tarefas no mesmo núcleo não podem passar uma pela outra
+void ssd1306_set_wait_hook(ssd1306_wait_hook_t wait, ssd1306_owner_hook_t owner) {
+    wait_hook = wait;
+    owner_hook = owner;
+}
+
+// Dono do barramento para quem chama: o do hook, ou o núcleo (sem sistema operacional)
+static inline void *ssd1306_bus_owner() {
+    if (owner_hook) {
+        return owner_hook();
+    }
+    return (void *) (uintptr_t) (get_core_num() + 1);
+}
+
+// Aguarda um evento: o fim de um envio assíncrono e a liberação do barramento sinalizam com __sev
+static inline void ssd1306_wait_event() {
+    if (wait_hook) {
+        wait_hook();
+    }
+    else {
+        __wfe();
+    }
+}
+
+// Aguarda o fim de um envio assíncrono em andamento
+void ssd1306_async_wait() {
+    while (async_busy) {
+        ssd1306_wait_event();
+    }
+}
+
+// Spin lock do barramento, reservado no primeiro uso (a inicialização ocorre antes de o núcleo 1 enviar)
+static inline spin_lock_t *ssd1306_bus_lock() {
+    if (!bus_lock) {
+        bus_lock = spin_lock_instance(spin_lock_claim_unused(true));
+    }
+    return bus_lock;
+}
+
+// Tenta tomar o barramento: livre de envio assíncrono e de escritas de outro dono. Com async, reserva-o
+// para um envio assíncrono, liberado pela interrupção de fim de envio
+static bool ssd1306_bus_try_claim(bool async) {
+    spin_lock_t *lock = ssd1306_bus_lock();
+    void *owner = ssd1306_bus_owner();
+    uint32_t save = spin_lock_blocking(lock);
+    bool claimed = !async_busy && (bus_depth == 0 || bus_owner == owner);
+
+    if (claimed) {
+        if (async) {
+            async_busy = true;
+        }
+        else {
+            bus_owner = owner;
+            bus_depth++;
+        }
+    }
+    spin_unlock(lock, save);
+
+    return claimed;
+}
+
+// Toma o barramento para escritas bloqueantes; as chamadas aninham para o mesmo dono
+static void ssd1306_bus_acquire() {
+    while (!ssd1306_bus_try_claim(false)) {
+        ssd1306_wait_event();
+    }
+}
+
+static void ssd1306_bus_release() {
+    uint32_t save = spin_lock_blocking(bus_lock);
+    bus_depth--;
+    spin_unlock(bus_lock, save);
+
+    __sev();
+}
+
+// Indica se há um envio assíncrono em andamento
+bool ssd1306_async_busy() {
+    return async_busy;
+}
+
+// Ajusta a porta para a velocidade da instância, se outra instância (ou a aplicação) a deixou em outro valor.
+// Só pode ser chamada com o barramento livre
+static void ssd1306_apply_bus_speed(ssd1306_display_t *display) {
+    uint index = i2c_hw_index(display->i2c);
+
+    if (port_khz[index] != display->bus_khz) {
+        i2c_set_baudrate(display->i2c, display->bus_khz * 1000);
+        port_khz[index] = display->bus_khz;
+    }
+}
+
+// Toda escrita no display passa por aqui, para que as transações possam ser contadas. O barramento não pode
+// ser usado enquanto o DMA alimenta a FIFO
+static int ssd1306_bus_write(struct ssd1306_bus_stats *stats, i2c_inst_t *i2c, uint8_t address, const uint8_t *src, size_t length) {
+    ssd1306_bus_acquire();
+
+    stats->transactions++;
+    stats->bytes += length;
+    int result = i2c_write_blocking(i2c, address, src, length, false);
+
+    ssd1306_bus_release();
+    return result;
+}
+
+// Escrita em uma instância, na velocidade configurada para ela
+static int ssd1306_i2c_write(ssd1306_display_t *display, const uint8_t *src, size_t length) {
+    ssd1306_bus_acquire();
+    ssd1306_apply_bus_speed(display);
+
+    int result = ssd1306_bus_write(&display->bus_stats, display->i2c, display->address, src, length);
+
+    ssd1306_bus_release();
+    return result;
+}
+
+// Marca as colunas [start_column, end_column] de uma página como alteradas
+static inline void ssd1306_mark_page_dirty(ssd1306_display_t *display, int page, int start_column, int end_column) {
+    ssd1306_spans_add(&display->dirty, page, start_column, end_column);
+    ssd1306_spans_add(&display->used, page, start_column, end_column);
+}
+
+// Marca uma área do buffer como alterada (para quem escreve diretamente no buffer)
+void ssd1306_mark_dirty(struct render_area *area) {
+    for (int page = area->start_page; page <= area->end_page; page++) {
+        ssd1306_mark_page_dirty(&default_display, page, area->start_column, area->end_column);
+    }
+}
+
+// Limpa o buffer, zerando apenas as colunas que possuíam conteúdo, e marca essas colunas para reenvio
+void ssd1306_clear(uint8_t *ssd) {
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        uint8_t start_column = display->used.start_column[page];
+        uint8_t end_column = display->used.end_column[page];
+
+        if (start_column > end_column) {
+            continue;
+        }
+
+        memset(ssd + page * ssd1306_width + start_column, 0, end_column - start_column + 1);
+
+        ssd1306_spans_add(&display->dirty, page, start_column, end_column);
+        display->used.start_column[page] = ssd1306_width - 1;
+        display->used.end_column[page] = 0;
+    }
+}
+
+// Retorna as estatísticas de envio (bytes enviados e economizados a cada render_on_display)
+const struct ssd1306_flush_stats *ssd1306_get_flush_stats() {
+    return &default_display.flush_stats;
+}
+
+// Retorna os contadores de transações e bytes no barramento
+const struct ssd1306_bus_stats *ssd1306_get_bus_stats() {
+    return &default_display.bus_stats;
+}
+
+// Zera os contadores de transações e bytes no barramento
+void ssd1306_reset_bus_stats() {
+    default_display.bus_stats.transactions = 0;
+    default_display.bus_stats.bytes = 0;
+    default_display.bus_stats.aborts = 0;
+}
+
+// Estatísticas de envio de uma instância; a vazão do último quadro é last_bytes_sent / last_time_us
+const struct ssd1306_flush_stats *ssd1306_display_flush_stats(ssd1306_display_t *display) {
+    return &display->flush_stats;
+}
+
+// Contadores de transações e bytes no barramento de uma instância
+const struct ssd1306_bus_stats *ssd1306_display_bus_stats(ssd1306_display_t *display) {
+    return &display->bus_stats;
+}
+
+// Calcular quanto do buffer será destinado à área de renderização
+void calculate_render_area_buffer_length(struct render_area *area) {
+    area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
+}
+
+// Processo de escrita do i2c espera um byte de controle, seguido por dados
+void ssd1306_send_command(uint8_t command) {
+    uint8_t buffer[2] = {0x80, command};
+    ssd1306_i2c_write(&default_display, buffer, 2);
+}
+
+// Envia uma lista de comandos numa única transação: o byte de controle 0x00 (Co = 0) indica que
+// todos os bytes seguintes são comandos. Listas maiores que o buffer são divididas em blocos
+static void ssd1306_write_command_list(struct ssd1306_bus_stats *stats, i2c_inst_t *i2c, uint8_t address, const uint8_t *commands, int number) {
+    uint8_t buffer[ssd1306_command_list_max + 1];
+
+    ssd1306_bus_acquire();
+    buffer[0] = 0x00;
+    while (number > 0) {
+        int chunk = number < ssd1306_command_list_max ? number : ssd1306_command_list_max;
+
+        memcpy(buffer + 1, commands, chunk);
+        ssd1306_bus_write(stats, i2c, address, buffer, chunk + 1);
+
+        commands += chunk;
+        number -= chunk;
+    }
+    ssd1306_bus_release();
+}
+
+// Envia uma lista de comandos a uma instância, na velocidade configurada para ela
+static void ssd1306_display_command_list(ssd1306_display_t *display, const uint8_t *commands, int number) {
+    ssd1306_bus_acquire();
+    ssd1306_apply_bus_speed(display);
+
+    ssd1306_write_command_list(&display->bus_stats, display->i2c, display->address, commands, number);
+    ssd1306_bus_release();
+}
+
+// Envia uma lista de comandos ao hardware
+void ssd1306_send_command_list(uint8_t *ssd, int number) {
+    ssd1306_display_command_list(&default_display, ssd, number);
+}
+
+// Envia os dados em ssd + offset usando o byte imediatamente anterior a eles como byte de controle
+// (restaurado após o envio). Esse byte precisa existir: o control reservado de um ssd1306_frame_t
+// (control_slot) ou um byte do próprio buffer (offset > 0). O barramento fica tomado durante a troca, de modo
+// que nenhum envio do driver lê o byte alterado (ver ssd1306_frame_t)
+static void ssd1306_send_in_place(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, int offset, int length) {
+    assert(offset > 0 || control_slot);
+    (void) control_slot; // Usado apenas no assert
+
+    uint8_t *data = ssd + offset;
+
+    ssd1306_bus_acquire();
+    uint8_t saved = data[-1];
+
+    data[-1] = 0x40;
+    ssd1306_i2c_write(display, data - 1, length + 1);
+    data[-1] = saved;
+    ssd1306_bus_release();
+}
+
+// Buffer estático de envio para buffers sem byte de controle reservado (evita malloc a cada quadro)
+static uint8_t send_buffer[ssd1306_buffer_length + 1];
+
+// Copia os dados no buffer de envio, a fim de adicionar o byte de controle desde o início
+static void ssd1306_send_copy(ssd1306_display_t *display, const uint8_t *ssd, int buffer_length) {
+    if (buffer_length > ssd1306_buffer_length) {
+        buffer_length = ssd1306_buffer_length;
+    }
+
+    // send_buffer é compartilhado: fica com quem tem o barramento
+    ssd1306_bus_acquire();
+    send_buffer[0] = 0x40;
+    memcpy(send_buffer + 1, ssd, buffer_length);
+
+    ssd1306_i2c_write(display, send_buffer, buffer_length + 1);
+    ssd1306_bus_release();
+}
+
+// Copia buffer de referência no buffer de envio, a fim de adicionar o byte de controle desde o início
+void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
+    ssd1306_send_copy(&default_display, ssd, buffer_length);
+}
+
+// Envia a sequência de inicialização (com base nos endereços definidos em ssd1306_i2c.h) conforme a geometria
+// da instância e marca a tela inteira para o primeiro envio
+static void ssd1306_display_setup(ssd1306_display_t *display) {
+    uint8_t commands[] = {
+        ssd1306_set_display, ssd1306_set_memory_mode, 0x00,
+        ssd1306_set_display_start_line, ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, display->height - 1,
+        ssd1306_set_common_output_direction | 0x08, ssd1306_set_display_offset,
+        0x00, ssd1306_set_common_pin_configuration,
+        display->width == 128 && display->height == 64 ? 0x12 : 0x02,
+        ssd1306_set_display_clock_divide_ratio, 0x80, ssd1306_set_precharge,
+        0xF1, ssd1306_set_vcomh_deselect_level, 0x30, ssd1306_set_contrast,
+        0xFF, ssd1306_set_entire_on, ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14, ssd1306_set_scroll | 0x00,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_display_command_list(display, commands, count_of(commands));
+
+    // O conteúdo da GDDRAM é desconhecido após a inicialização: o primeiro envio deve ser completo
+    ssd1306_spans_fill(&display->dirty);
+    ssd1306_spans_fill(&display->used);
+}
+
+// Inicializa a instância padrão (i2c1, endereço e geometria definidos em ssd1306_i2c.h)
+void ssd1306_init() {
+    default_display.i2c = i2c1;
+    default_display.address = ssd1306_i2c_address;
+    default_display.width = ssd1306_width;
+    default_display.height = ssd1306_height;
+    default_display.pages = ssd1306_n_pages;
+    default_display.bus_khz = ssd1306_i2c_clock;
+
+    ssd1306_display_setup(&default_display);
+}
+
+// Inicializa uma instância com framebuffer próprio. Dois painéis podem dividir a mesma porta (endereços
+// 0x3C e 0x3D) ou usar portas diferentes. bus_khz pode chegar a ssd1306_i2c_clock_fast_plus (1 MHz) se o
+// painel e os pull-ups suportarem; a porta é reajustada antes de cada transação da instância, então outros
+// dispositivos no mesmo barramento devem tolerar essa velocidade. width até ssd1306_width; height 32 ou 64
+void ssd1306_display_init(ssd1306_display_t *display, ssd1306_frame_t *frame, i2c_inst_t *i2c, uint8_t address, uint8_t width, uint8_t height, uint32_t bus_khz) {
+    assert(width <= ssd1306_width && height <= ssd1306_height && height % 8 == 0);
+
+    memset(display, 0, sizeof(*display));
+    display->i2c = i2c;
+    display->address = address;
+    display->width = width;
+    display->height = height;
+    display->pages = height / 8;
+    display->bus_khz = bus_khz;
+    display->frame = frame;
+    memset(frame, 0, sizeof(*frame));
+
+    assert(display_count < ssd1306_max_displays);
+    if (display_count < ssd1306_max_displays) {
+        displays[display_count++] = display;
+    }
+
+    ssd1306_display_setup(display);
+}
+
+// Altera a velocidade do barramento usada pela instância (aplicada na próxima transação)
+void ssd1306_display_set_bus_speed(ssd1306_display_t *display, uint32_t bus_khz) {
+    display->bus_khz = bus_khz;
+}
+
+// Cria a lista de comandos para configurar o scrolling
+void ssd1306_scroll(bool set) {
+    uint8_t commands[] = {
+        ssd1306_set_horizontal_scroll | 0x00, 0x00, 0x00, 0x00, 0x03,
+        0x00, 0xFF, ssd1306_set_scroll | (set ? 0x01 : 0)
+    };
+
+    ssd1306_send_command_list(commands, count_of(commands));
+}
+
+// Destino de cada janela alterada em um envio: i2c bloqueante ou fila do DMA
+typedef int (*ssd1306_window_writer)(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, uint8_t start_column, uint8_t end_column, uint8_t start_page, uint8_t end_page);
+
+// Envia ao display uma janela de colunas e páginas de um buffer com o layout da tela inteira
+// (control_slot indica que o byte anterior ao buffer está reservado, como em ssd1306_frame_t)
+static int ssd1306_send_window(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, uint8_t start_column, uint8_t end_column, uint8_t start_page, uint8_t end_page) {
+    // Preâmbulo da janela já empacotado com o byte de controle, enviado numa única transação
+    uint8_t preamble[] = {
+        0x00,
+        ssd1306_set_column_address, start_column, end_column,
+        ssd1306_set_page_address, start_page, end_page
+    };
+    int offset = start_page * ssd1306_width + start_column;
+    int length = (end_column - start_column + 1) * (end_page - start_page + 1);
+
+    ssd1306_i2c_write(display, preamble, count_of(preamble));
+
+    // Janelas que não começam no primeiro byte sempre têm um byte do próprio buffer antes delas
+    if (offset > 0 || control_slot) {
+        ssd1306_send_in_place(display, ssd, control_slot, offset, length);
+    }
+    else {
+        ssd1306_send_copy(display, ssd, length);
+    }
+
+    return length;
+}
+
+// Envia apenas as faixas de colunas alteradas de cada página; páginas inteiras consecutivas seguem numa única janela.
+// As faixas enviadas são esvaziadas. Colunas e páginas além da geometria da instância são descartadas. A janela de
+// várias páginas lê os bytes em sequência do framebuffer, cujo passo é sempre ssd1306_width: só é usada quando a
+// instância tem essa largura
+static int ssd1306_flush_dirty(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, struct ssd1306_page_spans *dirty, ssd1306_window_writer write_window) {
+    uint8_t last_column = display->width - 1;
+    int sent = 0;
+    int page = 0;
+
+    while (page < display->pages) {
+        uint8_t start_column = dirty->start_column[page];
+        uint8_t end_column = dirty->end_column[page] < last_column ? dirty->end_column[page] : last_column;
+
+        if (start_column > end_column) {
+            page++;
+            continue;
+        }
+
+        int end_page = page;
+        if (start_column == 0 && end_column == last_column && display->width == ssd1306_width) {
+            while (end_page + 1 < display->pages &&
+                   dirty->start_column[end_page + 1] == 0 &&
+                   dirty->end_column[end_page + 1] >= last_column) {
+                end_page++;
+            }
+        }
+
+        sent += write_window(display, ssd, control_slot, start_column, end_column, page, end_page);
+
+        page = end_page + 1;
+    }
+
+    ssd1306_spans_reset(dirty);
+
+    return sent;
+}
+
+// Indica se a área de renderização cobre a tela inteira (e portanto usa o rastreamento de regiões alteradas)
+static inline bool ssd1306_is_full_frame(ssd1306_display_t *display, struct render_area *area) {
+    return area->start_column == 0 && area->end_column == display->width - 1 &&
+           area->start_page == 0 && area->end_page == display->pages - 1;
+}
+
+// Envia as regiões alteradas da tela inteira e registra as estatísticas do envio
+static int ssd1306_render_dirty(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, struct ssd1306_page_spans *dirty, ssd1306_window_writer write_window) {
+    int frame_length = display->pages * display->width;
+    int sent = ssd1306_flush_dirty(display, ssd, control_slot, dirty, write_window);
+    struct ssd1306_flush_stats *stats = &display->flush_stats;
+
+    stats->flushes++;
+    stats->last_bytes_sent = sent;
+    stats->last_bytes_saved = frame_length - sent;
+    stats->total_bytes_sent += sent;
+    stats->total_bytes_saved += frame_length - sent;
+
+    return sent;
+}
+
+// Registra a duração de um envio (do início da primeira transação ao fim da última)
+static inline void ssd1306_record_flush_time(ssd1306_display_t *display) {
+    struct ssd1306_flush_stats *stats = &display->flush_stats;
+    uint32_t elapsed = time_us_32() - display->flush_start_us;
+
+    stats->last_time_us = elapsed;
+    stats->total_time_us += elapsed;
+    stats->timed_flushes++;
+    if (elapsed > stats->max_time_us) {
+        stats->max_time_us = elapsed;
+    }
+}
+
+// Atualiza o display com uma área de renderização, a partir de um buffer com ou sem byte de controle reservado
+static void ssd1306_render(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, struct render_area *area) {
+    // O barramento fica com o envio inteiro: as janelas seguem sem que outro núcleo reposicione o cursor
+    ssd1306_bus_acquire();
+
+    // A área da tela inteira usa o rastreamento de regiões alteradas; outras áreas usam um buffer próprio
+    if (ssd1306_is_full_frame(display, area)) {
+        display->flush_start_us = time_us_32();
+
+        if (ssd1306_render_dirty(display, ssd, control_slot, &display->dirty, ssd1306_send_window) > 0) {
+            ssd1306_record_flush_time(display);
+        }
+        ssd1306_bus_release();
+        return;
+    }
+
+    uint8_t preamble[] = {
+        0x00,
+        ssd1306_set_column_address, area->start_column, area->end_column,
+        ssd1306_set_page_address, area->start_page, area->end_page
+    };
+
+    ssd1306_i2c_write(display, preamble, count_of(preamble));
+
+    if (control_slot) {
+        ssd1306_send_in_place(display, ssd, control_slot, 0, area->buffer_length);
+    }
+    else {
+        ssd1306_send_copy(display, ssd, area->buffer_length);
+    }
+    ssd1306_bus_release();
+}
+
+// Atualiza uma parte do display com uma área de renderização. Envia sempre a área inteira, como antes do
+// rastreamento de regiões alteradas: o buffer pode ter sido escrito diretamente, sem ssd1306_mark_dirty.
+// O envio apenas das regiões alteradas fica com render_frame_on_display e as funções assíncronas
+void render_on_display(uint8_t *ssd, struct render_area *area) {
+    if (ssd1306_is_full_frame(&default_display, area)) {
+        ssd1306_spans_fill(&default_display.dirty);
+    }
+
+    ssd1306_render(&default_display, ssd, false, area);
+}
+
+// Atualiza uma parte do display a partir de um ssd1306_frame_t, sem cópias nem alocação
+void render_frame_on_display(ssd1306_frame_t *frame, struct render_area *area) {
+    ssd1306_render(&default_display, frame->buffer, true, area);
+}
+
+// Envia as regiões alteradas do framebuffer de uma instância (bloqueante)
+void ssd1306_display_render(ssd1306_display_t *display) {
+    struct render_area area = {
+        .start_column = 0, .end_column = display->width - 1,
+        .start_page = 0, .end_page = display->pages - 1
+    };
+
+    ssd1306_render(display, display->frame->buffer, true, &area);
+}
+
+// Acrescenta uma transação (byte de controle seguido dos dados) à fila do DMA; a partir da segunda
+// transação, o primeiro byte leva um RESTART, de modo que todo o envio segue num único fluxo
+static void ssd1306_async_append(uint8_t control, const uint8_t *data, int length) {
+    if (async_overflow || async_length + length + 1 > ssd1306_async_max_words) {
+        async_overflow = true;
+        return;
+    }
+
+    uint16_t *word = async_words + async_length;
+
+    *word++ = control | (async_length > 0 ? I2C_IC_DATA_CMD_RESTART_BITS : 0);
+    for (int i = 0; i < length; i++) {
+        *word++ = data[i];
+    }
+
+    async_length += length + 1;
+    async_display->bus_stats.transactions++;
+    async_display->bus_stats.bytes += length + 1;
+}
+
+// Enfileira uma janela de colunas e páginas (preâmbulo e dados) para o envio assíncrono
+static int ssd1306_queue_window(ssd1306_display_t *display, uint8_t *ssd, bool control_slot, uint8_t start_column, uint8_t end_column, uint8_t start_page, uint8_t end_page) {
+    // A fila recebe uma cópia dos dados e pertence a async_display: a instância e o byte reservado não são usados
+    (void) display;
+    (void) control_slot;
+
+    uint8_t commands[] = {
+        ssd1306_set_column_address, start_column, end_column,
+        ssd1306_set_page_address, start_page, end_page
+    };
+    int length = (end_column - start_column + 1) * (end_page - start_page + 1);
+
+    ssd1306_async_append(0x00, commands, count_of(commands));
+    ssd1306_async_append(0x40, ssd + start_page * ssd1306_width + start_column, length);
+
+    return length;
+}
+
+// Interrupção do i2c: o STOP final (ou um abort) indica que o último byte da fila saiu no barramento
+static void ssd1306_async_irq_handler() {
+    ssd1306_display_t *display = async_display;
+    i2c_hw_t *hw = i2c_get_hw(display->i2c);
+    uint32_t status = hw->intr_stat;
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        dma_channel_abort(async_dma_channel);
+        (void) hw->clr_tx_abrt;
+        display->bus_stats.aborts++;
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void) hw->clr_stop_det;
+
+        if (async_busy && !dma_channel_is_busy(async_dma_channel)) {
+            hw->intr_mask = 0;
+            ssd1306_record_flush_time(display);
+            async_busy = false;
+            __sev();
+
+            if (async_callback) {
+                async_callback(async_user_data);
+            }
+        }
+    }
+}
+
+// Reserva o canal de DMA no primeiro envio assíncrono
+static void ssd1306_async_setup() {
+    async_dma_channel = dma_claim_unused_channel(true);
+
+    async_dma_config = dma_channel_get_default_config(async_dma_channel);
+    channel_config_set_transfer_data_size(&async_dma_config, DMA_SIZE_16);
+    channel_config_set_read_increment(&async_dma_config, true);
+    channel_config_set_write_increment(&async_dma_config, false);
+}
+
+// Prepara uma nova fila de envio assíncrono para uma instância, aguardando o barramento (e reservando o DMA
+// na primeira vez). O barramento fica reservado até o fim do envio, ou até ssd1306_async_start com a fila vazia
+static void ssd1306_async_begin(ssd1306_display_t *display) {
+    while (!ssd1306_bus_try_claim(true)) {
+        ssd1306_wait_event();
+    }
+
+    if (async_dma_channel < 0) {
+        ssd1306_async_setup();
+    }
+
+    async_display = display;
+    async_length = 0;
+    async_overflow = false;
+}
+
+// Dispara o DMA com a fila montada; retorna false se a fila estiver vazia ou tiver transbordado. No
+// transbordamento nada é enviado e a tela inteira da instância volta a ser marcada como alterada
+static bool ssd1306_async_start(ssd1306_async_callback_t callback, void *user_data) {
+    if (async_length == 0 || async_overflow) {
+        if (async_overflow) {
+            ssd1306_spans_fill(&async_display->dirty);
+        }
+        async_busy = false;
+        __sev();
+        return false;
+    }
+
+    ssd1306_display_t *display = async_display;
+    uint index = i2c_hw_index(display->i2c);
+    static bool irq_installed[2];
+
+    // O DREQ e a interrupção dependem da porta da instância
+    if (!irq_installed[index]) {
+        irq_set_exclusive_handler(I2C0_IRQ + index, ssd1306_async_irq_handler);
+        irq_set_enabled(I2C0_IRQ + index, true);
+        irq_installed[index] = true;
+    }
+
+    channel_config_set_dreq(&async_dma_config, i2c_get_dreq(display->i2c, true));
+    dma_channel_set_config(async_dma_channel, &async_dma_config, false);
+    dma_channel_set_write_addr(async_dma_channel, &i2c_get_hw(display->i2c)->data_cmd, false);
+
+    ssd1306_apply_bus_speed(display);
+
+    async_words[async_length - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    async_callback = callback;
+    async_user_data = user_data;
+    display->flush_start_us = time_us_32();
+
+    i2c_hw_t *hw = i2c_get_hw(display->i2c);
+    hw->enable = 0;
+    hw->tar = display->address;
+    hw->dma_tdlr = 8;
+    hw->enable = 1;
+    (void) hw->clr_stop_det;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+
+    dma_channel_transfer_from_buffer_now(async_dma_channel, async_words, async_length);
+
+    return true;
+}
+
+// Enfileira uma área de uma instância: a tela inteira usa o rastreamento de regiões alteradas
+static void ssd1306_queue_area(ssd1306_display_t *display, uint8_t *ssd, struct render_area *area) {
+    if (ssd1306_is_full_frame(display, area)) {
+        ssd1306_render_dirty(display, ssd, false, &display->dirty, ssd1306_queue_window);
+        return;
+    }
+
+    uint8_t commands[] = {
+        ssd1306_set_column_address, area->start_column, area->end_column,
+        ssd1306_set_page_address, area->start_page, area->end_page
+    };
+
+    ssd1306_async_append(0x00, commands, count_of(commands));
+    ssd1306_async_append(0x40, ssd, area->buffer_length);
+}
+
+// Atualiza o display sem bloquear: a área é copiada para a fila do DMA, que alimenta a FIFO de transmissão
+// do i2c1. O buffer pode ser alterado assim que a função retorna. Ao fim do envio, callback (se houver) é
+// chamada em contexto de interrupção, onde pode, por exemplo, notificar uma tarefa do FreeRTOS.
+// Retorna false quando não há nada a enviar ou a área não cabe na fila (ssd1306_async_max_words); a callback
+// não é chamada nesses casos
+bool render_on_display_async(uint8_t *ssd, struct render_area *area, ssd1306_async_callback_t callback, void *user_data) {
+    ssd1306_async_begin(&default_display);
+    ssd1306_queue_area(&default_display, ssd, area);
+
+    return ssd1306_async_start(callback, user_data);
+}
+
+// Versão assíncrona de ssd1306_display_render, com as mesmas regras de render_on_display_async. Um envio
+// para outra instância aguarda o término deste
+bool ssd1306_display_render_async(ssd1306_display_t *display, ssd1306_async_callback_t callback, void *user_data) {
+    struct render_area area = {
+        .start_column = 0, .end_column = display->width - 1,
+        .start_page = 0, .end_page = display->pages - 1
+    };
+
+    ssd1306_async_begin(display);
+    ssd1306_queue_area(display, display->frame->buffer, &area);
+
+    return ssd1306_async_start(callback, user_data);
+}
+
+// Modo de buffer duplo da instância padrão: os produtores desenham em db_back e publicam o quadro trocando
+// os ponteiros; o laço de envio (núcleo 1 ou uma tarefa) transmite db_front. db_pending acumula as regiões
+// publicadas que ainda não foram enviadas. A troca e a leitura de db_front para a fila do DMA ocorrem sob db_lock
+static ssd1306_frame_t db_frames[2];
+static ssd1306_frame_t *db_front;
+static ssd1306_frame_t *db_back;
+static struct ssd1306_page_spans db_pending;
+static volatile bool db_has_pending;
+static spin_lock_t *db_lock;
+
+// Inicializa o modo de buffer duplo (após ssd1306_init); o primeiro envio cobre a tela inteira
+void ssd1306_db_init() {
+    memset(db_frames, 0, sizeof(db_frames));
+    db_front = &db_frames[0];
+    db_back = &db_frames[1];
+    db_lock = spin_lock_instance(spin_lock_claim_unused(true));
+
+    ssd1306_spans_fill(&db_pending);
+    db_has_pending = true;
+    ssd1306_spans_reset(&default_display.dirty);
+    ssd1306_spans_reset(&default_display.used);
+}
+
+// Buffer em que os produtores devem desenhar; muda a cada ssd1306_db_publish
+uint8_t *ssd1306_db_back() {
+    return db_back->buffer;
+}
+
+// Publica o buffer desenhado: troca os ponteiros, acumula as regiões alteradas para o laço de envio e
+// copia essas regiões para o novo buffer de trás, para que os produtores continuem do quadro publicado
+void ssd1306_db_publish() {
+    struct ssd1306_page_spans published = default_display.dirty;
+
+    uint32_t save = spin_lock_blocking(db_lock);
+    ssd1306_frame_t *frame = db_front;
+    db_front = db_back;
+    db_back = frame;
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        if (published.start_column[page] <= published.end_column[page]) {
+            ssd1306_spans_add(&db_pending, page, published.start_column[page], published.end_column[page]);
+            db_has_pending = true;
+        }
+    }
+    spin_unlock(db_lock, save);
+
+    // Acorda o núcleo 1 caso esteja aguardando em __wfe
+    __sev();
+
+    ssd1306_spans_reset(&default_display.dirty);
+    for (int page = 0; page < ssd1306_n_pages; page++) {
+        uint8_t start_column = published.start_column[page];
+        uint8_t end_column = published.end_column[page];
+
+        if (start_column <= end_column) {
+            int offset = page * ssd1306_width + start_column;
+            memcpy(db_back->buffer + offset, db_front->buffer + offset, end_column - start_column + 1);
+        }
+    }
+}
+
+// Envia as regiões publicadas e ainda pendentes de db_front via DMA. Retorna false se não houver nada
+// pendente; a callback segue as regras de render_on_display_async
+bool ssd1306_db_flush(ssd1306_async_callback_t callback, void *user_data) {
+    if (!db_has_pending) {
+        return false;
+    }
+
+    ssd1306_async_begin(&default_display);
+
+    uint32_t save = spin_lock_blocking(db_lock);
+    ssd1306_render_dirty(&default_display, db_front->buffer, false, &db_pending, ssd1306_queue_window);
+    db_has_pending = false;
+    spin_unlock(db_lock, save);
+
+    // Fila transbordada: o quadro inteiro volta a ficar pendente
+    if (async_overflow) {
+        save = spin_lock_blocking(db_lock);
+        ssd1306_spans_fill(&db_pending);
+        db_has_pending = true;
+        spin_unlock(db_lock, save);
+    }
+
+    return ssd1306_async_start(callback, user_data);
+}
+
+// Laço de envio do núcleo 1: dorme em __wfe até que um quadro seja publicado
+static void ssd1306_db_core1_entry() {
+    while (true) {
+        if (ssd1306_db_flush(NULL, NULL)) {
+            ssd1306_async_wait();
+        }
+        else {
+            __wfe();
+        }
+    }
+}
+
+// Inicia o laço de envio no núcleo 1 (não usar junto com o FreeRTOS SMP, que ocupa os dois núcleos)
+void ssd1306_db_launch_core1() {
+    multicore_launch_core1(ssd1306_db_core1_entry);
+}
+
+// Determina o pixel a ser aceso (no display) de acordo com a coordenada fornecida
+void ssd1306_set_pixel(uint8_t *ssd, int x, int y, bool set) {
+    assert(x >= 0 && x < ssd1306_width && y >= 0 && y < ssd1306_height);
+
+    const int bytes_per_row = ssd1306_width;
+
+    int byte_idx = (y / 8) * bytes_per_row + x;
+    uint8_t byte = ssd[byte_idx];
+
+    ssd1306_mark_page_dirty(ssd1306_owner(ssd), y / 8, x, x);
+
+    if (set) {
+        byte |= 1 << (y % 8);
+    }
+    else {
+        byte &= ~(1 << (y % 8));
+    }
+
+    ssd[byte_idx] = byte;
+}
+
+// Máscaras de página: bits a partir da linha n (topo recortado) e até a linha n (base recortada)
+static const uint8_t page_mask_from[8] = {0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xE0, 0xC0, 0x80};
+static const uint8_t page_mask_to[8] = {0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+// Recorta um retângulo à tela; retorna false se nada sobrar
+static inline bool ssd1306_clip_rect(int *x, int *y, int *width, int *height) {
+    if (*x < 0) { *width += *x; *x = 0; }
+    if (*y < 0) { *height += *y; *y = 0; }
+    if (*x + *width > ssd1306_width) *width = ssd1306_width - *x;
+    if (*y + *height > ssd1306_height) *height = ssd1306_height - *y;
+
+    return *width > 0 && *height > 0;
+}
+
+// Aplica dst = (dst & ~clear) ^ set a um retângulo, byte a byte: cada página recebe uma única máscara
+// (parcial na primeira e na última página) e o laço interno percorre apenas as colunas
+static void ssd1306_apply_rect(uint8_t *ssd, int x, int y, int width, int height, bool clear, bool set) {
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+
+    if (!ssd1306_clip_rect(&x, &y, &width, &height)) {
+        return;
+    }
+
+    int first_page = y / 8;
+    int last_page = (y + height - 1) / 8;
+
+    for (int page = first_page; page <= last_page; page++) {
+        uint8_t mask = 0xFF;
+        if (page == first_page) mask &= page_mask_from[y % 8];
+        if (page == last_page) mask &= page_mask_to[(y + height - 1) % 8];
+
+        uint8_t clear_mask = clear ? mask : 0;
+        uint8_t set_mask = set ? mask : 0;
+        uint8_t *row = ssd + page * ssd1306_width + x;
+
+        for (int i = 0; i < width; i++) {
+            row[i] = (row[i] & ~clear_mask) ^ set_mask;
+        }
+
+        ssd1306_mark_page_dirty(display, page, x, x + width - 1);
+    }
+}
+
+// Preenche (set) ou apaga um retângulo
+void ssd1306_fill_rect(uint8_t *ssd, int x, int y, int width, int height, bool set) {
+    ssd1306_apply_rect(ssd, x, y, width, height, true, set);
+}
+
+// Apaga um retângulo (equivale a ssd1306_fill_rect com set = false)
+void ssd1306_clear_rect(uint8_t *ssd, int x, int y, int width, int height) {
+    ssd1306_apply_rect(ssd, x, y, width, height, true, false);
+}
+
+// Inverte os pixels de um retângulo
+void ssd1306_invert_rect(uint8_t *ssd, int x, int y, int width, int height) {
+    ssd1306_apply_rect(ssd, x, y, width, height, false, true);
+}
+
+// Linha horizontal a partir de (x, y) com a largura dada
+void ssd1306_draw_hline(uint8_t *ssd, int x, int y, int width, bool set) {
+    ssd1306_apply_rect(ssd, x, y, width, 1, true, set);
+}
+
+// Linha vertical a partir de (x, y) com a altura dada
+void ssd1306_draw_vline(uint8_t *ssd, int x, int y, int height, bool set) {
+    ssd1306_apply_rect(ssd, x, y, 1, height, true, set);
+}
+
+// Contorno de um retângulo
+void ssd1306_draw_rect(uint8_t *ssd, int x, int y, int width, int height, bool set) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    ssd1306_draw_hline(ssd, x, y, width, set);
+    ssd1306_draw_hline(ssd, x, y + height - 1, width, set);
+    ssd1306_draw_vline(ssd, x, y + 1, height - 2, set);
+    ssd1306_draw_vline(ssd, x + width - 1, y + 1, height - 2, set);
+}
+
+// Código de região de Cohen-Sutherland de um ponto em relação à tela
+static inline int ssd1306_outcode(int x, int y) {
+    int code = 0;
+
+    if (x < 0) code |= 1;
+    else if (x >= ssd1306_width) code |= 2;
+    if (y < 0) code |= 4;
+    else if (y >= ssd1306_height) code |= 8;
+
+    return code;
+}
+
+// Recorta o segmento à tela (Cohen-Sutherland); retorna false se ele estiver inteiramente fora
+static bool ssd1306_clip_line(int *x_0, int *y_0, int *x_1, int *y_1) {
+    int code_0 = ssd1306_outcode(*x_0, *y_0);
+    int code_1 = ssd1306_outcode(*x_1, *y_1);
+
+    while (code_0 | code_1) {
+        if (code_0 & code_1) {
+            return false;
+        }
+
+        int code = code_0 ? code_0 : code_1;
+        int x, y;
+
+        if (code & 8) {
+            x = *x_0 + (*x_1 - *x_0) * (ssd1306_height - 1 - *y_0) / (*y_1 - *y_0);
+            y = ssd1306_height - 1;
+        }
+        else if (code & 4) {
+            x = *x_0 + (*x_1 - *x_0) * (0 - *y_0) / (*y_1 - *y_0);
+            y = 0;
+        }
+        else if (code & 2) {
+            y = *y_0 + (*y_1 - *y_0) * (ssd1306_width - 1 - *x_0) / (*x_1 - *x_0);
+            x = ssd1306_width - 1;
+        }
+        else {
+            y = *y_0 + (*y_1 - *y_0) * (0 - *x_0) / (*x_1 - *x_0);
+            x = 0;
+        }
+
+        if (code == code_0) {
+            *x_0 = x;
+            *y_0 = y;
+            code_0 = ssd1306_outcode(x, y);
+        }
+        else {
+            *x_1 = x;
+            *y_1 = y;
+            code_1 = ssd1306_outcode(x, y);
+        }
+    }
+
+    return true;
+}
+
+// Algoritmo de Bresenham básico, com o segmento recortado à tela antes do traçado: o laço escreve direto
+// no buffer (sem ssd1306_set_pixel nem assert) e marca a faixa alterada uma vez por página
+void ssd1306_draw_line(uint8_t *ssd, int x_0, int y_0, int x_1, int y_1, bool set) {
+    if (!ssd1306_clip_line(&x_0, &y_0, &x_1, &y_1)) {
+        return;
+    }
+
+    // Linhas horizontais e verticais seguem pelos preenchimentos byte a byte
+    if (y_0 == y_1) {
+        int x = x_0 < x_1 ? x_0 : x_1;
+        ssd1306_draw_hline(ssd, x, y_0, abs(x_1 - x_0) + 1, set);
+        return;
+    }
+    if (x_0 == x_1) {
+        int y = y_0 < y_1 ? y_0 : y_1;
+        ssd1306_draw_vline(ssd, x_0, y, abs(y_1 - y_0) + 1, set);
+        return;
+    }
+
+    int dx = abs(x_1 - x_0); // Deslocamentos
+    int dy = -abs(y_1 - y_0);
+    int sx = x_0 < x_1 ? 1 : -1; // Direção de avanço
+    int sy = y_0 < y_1 ? 1 : -1;
+    int error = dx + dy; // Erro acumulado
+    int error_2;
+
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+    int page = y_0 >> 3; // Página atual e faixa de colunas alteradas nela
+    int span_start = x_0;
+    int span_end = x_0;
+
+    while (true) {
+        uint8_t *byte = ssd + (y_0 >> 3) * ssd1306_width + x_0;
+        uint8_t bit = 1 << (y_0 & 7);
+        *byte = set ? *byte | bit : *byte & ~bit; // Acende pixel no ponto atual
+
+        if ((y_0 >> 3) != page) {
+            ssd1306_mark_page_dirty(display, page, span_start, span_end);
+            page = y_0 >> 3;
+            span_start = span_end = x_0;
+        }
+        else if (x_0 < span_start) {
+            span_start = x_0;
+        }
+        else if (x_0 > span_end) {
+            span_end = x_0;
+        }
+
+        if (x_0 == x_1 && y_0 == y_1) {
+            break; // Verifica se o ponto final foi alcançado
+        }
+
+        error_2 = 2 * error; // Ajusta o erro acumulado
+
+        if (error_2 >= dy) {
+            error += dy;
+            x_0 += sx; // Avança na direção x
+        }
+        if (error_2 <= dx) {
+            error += dx;
+            y_0 += sy; // Avança na direção y
+        }
+    }
+
+    ssd1306_mark_page_dirty(display, page, span_start, span_end);
+}
+
+// Desenha um único caractere (código Latin-1) no display; o glifo é indexado diretamente pelo código
+void ssd1306_draw_char(uint8_t *ssd, int16_t x, int16_t y, uint8_t character) {
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+
+    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+        return;
+    }
+
+    y = y / 8;
+
+    const uint8_t *glyph = font + character * 8;
+    int fb_idx = y * 128 + x;
+
+    for (int i = 0; i < 8; i++) {
+        ssd[fb_idx++] = glyph[i];
+    }
+
+    ssd1306_mark_page_dirty(display, y, x, x + 7);
+}
+
+// Lê o próximo caractere de uma string UTF-8 e o converte para Latin-1. ASCII segue pelo caminho rápido;
+// sequências de dois bytes até U+00FF são decodificadas e as demais viram '?'. Um byte acima de 0x7F sem
+// continuação válida é tratado como Latin-1 puro
+static inline uint8_t ssd1306_next_char(const char **string) {
+    const uint8_t *s = (const uint8_t *) *string;
+    uint8_t c = *s++;
+
+    if (c >= 0x80 && (*s & 0xC0) == 0x80) {
+        if ((c & 0xE0) == 0xC0) {
+            uint16_t codepoint = ((c & 0x1F) << 6) | (*s++ & 0x3F);
+            c = codepoint <= 0xFF ? codepoint : '?';
+        }
+        else {
+            while ((*s & 0xC0) == 0x80) {
+                s++;
+            }
+            c = '?';
+        }
+    }
+
+    *string = (const char *) s;
+    return c;
+}
+
+// Desenha uma string UTF-8, chamando a função de desenhar caractere várias vezes
+void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string) {
+    if (x > ssd1306_width - 8 || y > ssd1306_height - 8) {
+        return;
+    }
+
+    while (*string && x <= ssd1306_width - 8) {
+        ssd1306_draw_char(ssd, x, y, ssd1306_next_char(&string));
+        x += 8;
+    }
+}
+
+// Desenha um caractere em qualquer posição (x, y), inclusive fora do alinhamento de página e parcialmente fora
+// da tela. Cada coluna do glifo é deslocada como um valor de 16 bits que cobre duas páginas e combinada com
+// o buffer segundo o modo: dst = (dst & ~clear) ^ set, com as máscaras escolhidas fora do laço
+void ssd1306_blit_char(uint8_t *ssd, int x, int y, uint8_t character, enum ssd1306_blit_mode mode) {
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+
+    if (x <= -8 || x >= ssd1306_width || y <= -8 || y >= ssd1306_height) {
+        return;
+    }
+
+    int page = (y + 8) / 8 - 1; // Divisão com arredondamento para baixo também para y negativo
+    int shift = y - page * 8;
+    int start = x < 0 ? -x : 0;
+    int end = x + 8 > ssd1306_width ? ssd1306_width - x : 8;
+    const uint8_t *glyph = font + character * 8;
+
+    uint16_t clear_select = mode == ssd1306_blit_xor ? 0 : 0xFFFF;
+    uint16_t set_select = mode == ssd1306_blit_and_not ? 0 : 0xFFFF;
+    uint16_t cell = mode == ssd1306_blit_copy ? 0xFF << shift : 0;
+
+    // Páginas fora da tela recebem um ponteiro nulo e são ignoradas
+    uint8_t *upper = page >= 0 ? ssd + page * ssd1306_width + x : NULL;
+    uint8_t *lower = shift && page + 1 < ssd1306_n_pages ? ssd + (page + 1) * ssd1306_width + x : NULL;
+
+    for (int i = start; i < end; i++) {
+        uint16_t bits = glyph[i] << shift;
+        uint16_t clear = (bits & clear_select) | cell;
+        uint16_t set = bits & set_select;
+
+        if (upper) {
+            upper[i] = (upper[i] & ~clear) ^ set;
+        }
+        if (lower) {
+            lower[i] = (lower[i] & ~(clear >> 8)) ^ (set >> 8);
+        }
+    }
+
+    if (upper) {
+        ssd1306_mark_page_dirty(display, page, x + start, x + end - 1);
+    }
+    if (lower) {
+        ssd1306_mark_page_dirty(display, page + 1, x + start, x + end - 1);
+    }
+}
+
+// Desenha uma string UTF-8 em qualquer posição, com recorte e modo de composição
+void ssd1306_blit_string(uint8_t *ssd, int x, int y, const char *string, enum ssd1306_blit_mode mode) {
+    while (*string && x < ssd1306_width) {
+        ssd1306_blit_char(ssd, x, y, ssd1306_next_char(&string), mode);
+        x += 8;
+    }
+}
+
+// Inicializa um campo de texto em (x, y) com a largura dada em caracteres. O campo começa vazio
+// (supõe a área já limpa no buffer)
+void ssd1306_text_field_init(struct ssd1306_text_field *field, int x, int y, int columns) {
+    field->x = x;
+    field->y = y;
+    field->columns = columns < ssd1306_text_field_max_columns ? columns : ssd1306_text_field_max_columns;
+    field->length = 0;
+    field->valid = true;
+}
+
+// Faz o próximo ssd1306_text_field_set redesenhar o campo inteiro (ex.: após limpar o buffer)
+void ssd1306_text_field_invalidate(struct ssd1306_text_field *field) {
+    field->valid = false;
+}
+
+// Atualiza o texto (UTF-8) do campo, redesenhando apenas as células cujo caractere mudou; células que
+// sobram de um texto mais longo são apagadas. Sem mudanças, nada é desenhado nem marcado como alterado.
+// Retorna true se algo foi redesenhado
+bool ssd1306_text_field_set(uint8_t *ssd, struct ssd1306_text_field *field, const char *text) {
+    uint8_t cells[ssd1306_text_field_max_columns];
+    int length = 0;
+    bool changed = false;
+
+    while (*text && length < field->columns) {
+        cells[length++] = ssd1306_next_char(&text);
+    }
+
+    int end = field->valid ? (length > field->length ? length : field->length) : field->columns;
+
+    for (int i = 0; i < end; i++) {
+        uint8_t character = i < length ? cells[i] : ' ';
+        uint8_t previous = i < field->length ? field->cells[i] : ' ';
+
+        if (!field->valid || character != previous) {
+            ssd1306_blit_char(ssd, field->x + i * 8, field->y, character, ssd1306_blit_copy);
+            changed = true;
+        }
+    }
+
+    memcpy(field->cells, cells, length);
+    field->length = length;
+    field->valid = true;
+
+    return changed;
+}
+
+// Formata o texto como printf e o envia ao campo com ssd1306_text_field_set
+bool ssd1306_text_field_printf(uint8_t *ssd, struct ssd1306_text_field *field, const char *format, ...) {
+    char text[ssd1306_text_field_max_columns * 2 + 1]; // Caracteres Latin-1 ocupam até 2 bytes em UTF-8
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    return ssd1306_text_field_set(ssd, field, text);
+}
+
+// Inicia o modo console: limpa o buffer e a tela e volta a linha inicial para 0. O buffer pertence ao console
+// até ssd1306_console_end; as linhas são enviadas de forma bloqueante, uma página por linha
+void ssd1306_console_init(struct ssd1306_console *console, uint8_t *ssd) {
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+    uint8_t command = ssd1306_set_display_start_line;
+
+    console->ssd = ssd;
+    console->lines = display->pages;
+    console->top = 0;
+    console->count = 0;
+    console->active = true;
+
+    memset(ssd, 0, ssd1306_buffer_length);
+    ssd1306_spans_fill(&display->dirty);
+    ssd1306_spans_reset(&display->used);
+
+    ssd1306_display_command_list(display, &command, 1);
+    ssd1306_render_dirty(display, ssd, false, &display->dirty, ssd1306_send_window);
+}
+
+// Acrescenta uma linha (UTF-8, até 16 caracteres) ao console. Enquanto a tela não enche, as linhas vão para as
+// páginas seguintes; depois, a linha vai para a página logo abaixo da janela visível (a mais antiga, num
+// display de 64 linhas) e a linha inicial avança uma página. Custa uma lista de comandos de 8 bytes (linha
+// inicial e janela) e uma página de dados, em vez do quadro inteiro. Sem efeito fora do modo console
+void ssd1306_console_print(struct ssd1306_console *console, const char *text) {
+    if (!console->active) {
+        return;
+    }
+
+    ssd1306_display_t *display = ssd1306_owner(console->ssd);
+    int page;
+
+    if (console->count < console->lines) {
+        page = console->top + console->count++;
+    }
+    else {
+        page = (console->top + console->lines) % ssd1306_n_pages;
+        console->top = (console->top + 1) % ssd1306_n_pages;
+    }
+
+    uint8_t *row = console->ssd + page * ssd1306_width;
+    memset(row, 0, ssd1306_width);
+    ssd1306_draw_string(console->ssd, 0, page * 8, text);
+
+    // A rolagem e a janela da página seguem juntas numa única transação de comandos
+    uint8_t commands[] = {
+        ssd1306_set_display_start_line | (console->top * 8),
+        ssd1306_set_column_address, 0, display->width - 1,
+        ssd1306_set_page_address, page, page
+    };
+
+    ssd1306_bus_acquire();
+    ssd1306_display_command_list(display, commands, count_of(commands));
+    if (page > 0) {
+        ssd1306_send_in_place(display, console->ssd, false, page * ssd1306_width, display->width);
+    }
+    else {
+        ssd1306_send_copy(display, row, display->width);
+    }
+    ssd1306_bus_release();
+
+    display->dirty.start_column[page] = ssd1306_width - 1;
+    display->dirty.end_column[page] = 0;
+}
+
+// Formata a linha como printf e a acrescenta ao console
+void ssd1306_console_printf(struct ssd1306_console *console, const char *format, ...) {
+    char text[ssd1306_text_field_max_columns * 2 + 1];
+    va_list args;
+
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    ssd1306_console_print(console, text);
+}
+
+// Encerra o modo console: volta a linha inicial para 0 e limpa o buffer, marcando a tela inteira para o
+// próximo envio (a GDDRAM ainda contém as linhas do console, em páginas rotacionadas)
+void ssd1306_console_end(struct ssd1306_console *console) {
+    ssd1306_display_t *display = ssd1306_owner(console->ssd);
+    uint8_t command = ssd1306_set_display_start_line;
+
+    console->active = false;
+
+    memset(console->ssd, 0, ssd1306_buffer_length);
+    ssd1306_spans_fill(&display->dirty);
+    ssd1306_spans_reset(&display->used);
+
+    ssd1306_display_command_list(display, &command, 1);
+}
+
+// Decodifica um bitmap comprimido em RLE direto no framebuffer, na coluna x e na página page. O bitmap tem
+// width colunas e pages páginas, com os bytes no layout das páginas do display, página a página. Cada bloco
+// começa com um byte de controle n: com o bit 7 aceso, o byte seguinte se repete (n & 0x7F) + 1 vezes; caso
+// contrário seguem n + 1 bytes literais. Colunas e páginas fora da tela são descartadas
+void ssd1306_draw_rle(uint8_t *ssd, int x, int page, int width, int pages, const uint8_t *rle) {
+    ssd1306_display_t *display = ssd1306_owner(ssd);
+    int column = 0;
+    int row = 0;
+
+    // Cada bloco é aplicado em trechos que não passam do fim da linha de páginas do bitmap: uma repetição vira
+    // memset e um literal vira memcpy, já recortados à tela
+    while (row < pages) {
+        uint8_t control = *rle++;
+        bool run = control & 0x80;
+        int count = (control & 0x7F) + 1;
+
+        while (count > 0 && row < pages) {
+            int length = count < width - column ? count : width - column;
+            int screen_page = page + row;
+            int first = x + column;
+            int last = first + length - 1;
+            int skip = first < 0 ? -first : 0;
+
+            if (last >= ssd1306_width) {
+                last = ssd1306_width - 1;
+            }
+            if (screen_page >= 0 && screen_page < ssd1306_n_pages && first + skip <= last) {
+                uint8_t *dst = ssd + screen_page * ssd1306_width + first + skip;
+
+                if (run) {
+                    memset(dst, *rle, last - first - skip + 1);
+                }
+                else {
+                    memcpy(dst, rle + skip, last - first - skip + 1);
+                }
+            }
+
+            if (!run) {
+                rle += length;
+            }
+            count -= length;
+            column += length;
+            if (column == width) {
+                column = 0;
+                row++;
+            }
+        }
+        if (run) {
+            rle++;
+        }
+    }
+
+    int start_column = x < 0 ? 0 : x;
+    int end_column = x + width - 1 >= ssd1306_width ? ssd1306_width - 1 : x + width - 1;
+
+    for (int row = page < 0 ? 0 : page; row < page + pages && row < ssd1306_n_pages && start_column <= end_column; row++) {
+        ssd1306_mark_page_dirty(display, row, start_column, end_column);
+    }
+}
+
+// Comando de configuração com base na estrutura ssd1306_t
+void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+  ssd->port_buffer[1] = command;
+  ssd1306_bus_write(&default_display.bus_stats, ssd->i2c_port, ssd->address, ssd->port_buffer, 2);
+}
+
+// Envia uma lista de comandos de configuração numa única transação
+void ssd1306_command_list(ssd1306_t *ssd, const uint8_t *commands, int number) {
+  ssd1306_write_command_list(&default_display.bus_stats, ssd->i2c_port, ssd->address, commands, number);
+}
+
+// Função de configuração do display para o caso do bitmap
+void ssd1306_config(ssd1306_t *ssd) {
+    const uint8_t commands[] = {
+        ssd1306_set_display | 0x00,
+        ssd1306_set_memory_mode, 0x01,
+        ssd1306_set_display_start_line | 0x00,
+        ssd1306_set_segment_remap | 0x01,
+        ssd1306_set_mux_ratio, ssd1306_height - 1,
+        ssd1306_set_common_output_direction | 0x08,
+        ssd1306_set_display_offset, 0x00,
+        ssd1306_set_common_pin_configuration, 0x12,
+        ssd1306_set_display_clock_divide_ratio, 0x80,
+        ssd1306_set_precharge, 0xF1,
+        ssd1306_set_vcomh_deselect_level, 0x30,
+        ssd1306_set_contrast, 0xFF,
+        ssd1306_set_entire_on,
+        ssd1306_set_normal_display,
+        ssd1306_set_charge_pump, 0x14,
+        ssd1306_set_display | 0x01,
+    };
+
+    ssd1306_command_list(ssd, commands, count_of(commands));
+}
+
+// Inicializa o display para o caso de exibição de bitmap
+void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
+    ssd->width = width;
+    ssd->height = height;
+    ssd->pages = height / 8U;
+    ssd->address = address;
+    ssd->i2c_port = i2c;
+    ssd->external_vcc = external_vcc;
+    ssd->bufsize = ssd->pages * ssd->width + 1;
+    ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+    ssd->ram_buffer[0] = 0x40;
+    ssd->port_buffer[0] = 0x80;
+}
+
+// Envia os dados ao display
+void ssd1306_send_data(ssd1306_t *ssd) {
+    uint8_t preamble[] = {
+        0x00,
+        ssd1306_set_column_address, 0, ssd->width - 1,
+        ssd1306_set_page_address, 0, ssd->pages - 1
+    };
+
+    ssd1306_bus_acquire();
+    ssd1306_bus_write(&default_display.bus_stats, ssd->i2c_port, ssd->address, preamble, count_of(preamble));
+    ssd1306_bus_write(&default_display.bus_stats, ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize);
+    ssd1306_bus_release();
+}
+
+// Envia ao display apenas as colunas [start_column, end_column] (todas as páginas). No modo de endereçamento
+// vertical usado por ssd1306_config essas colunas são contíguas em ram_buffer, então o byte anterior a
+// elas serve de byte de controle e o envio é feito sem cópia
+void ssd1306_send_columns(ssd1306_t *ssd, uint8_t start_column, uint8_t end_column) {
+    uint8_t preamble[] = {
+        0x00,
+        ssd1306_set_column_address, start_column, end_column,
+        ssd1306_set_page_address, 0, ssd->pages - 1
+    };
+    uint8_t *data = ssd->ram_buffer + 1 + start_column * ssd->pages;
+    int length = (end_column - start_column + 1) * ssd->pages;
+    uint8_t saved = data[-1];
+
+    ssd1306_bus_acquire();
+    ssd1306_bus_write(&default_display.bus_stats, ssd->i2c_port, ssd->address, preamble, count_of(preamble));
+
+    data[-1] = 0x40;
+    ssd1306_bus_write(&default_display.bus_stats, ssd->i2c_port, ssd->address, data - 1, length + 1);
+    data[-1] = saved;
+    ssd1306_bus_release();
+}
+
+// Copia um bitmap de width x height pixels para ram_buffer na posição (x, y), recortando o que sair da tela.
+// O bitmap segue o layout de ram_buffer: coluna a coluna, com (height + 7) / 8 bytes por coluna e o bit
+// menos significativo no topo. Cada coluna do display (até 64 pixels) é tratada como um único uint64_t,
+// o que permite qualquer y sem laço por pixel; os pixels fora do retângulo são preservados
+void ssd1306_blit(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height) {
+    if (height > 64) {
+        height = 64;
+    }
+
+    int bytes_per_column = (height + 7) / 8;
+    int start = x < 0 ? -x : 0;
+    int end = x + width > ssd->width ? ssd->width - x : width;
+
+    // Máscara das linhas ocupadas pelo bitmap, já deslocada para y e recortada à altura do display
+    uint64_t mask = height == 64 ? ~0ULL : (1ULL << height) - 1;
+    if (y >= 0) {
+        mask = y < 64 ? mask << y : 0;
+    }
+    else {
+        mask = -y < 64 ? mask >> -y : 0;
+    }
+    if (ssd->height < 64) {
+        mask &= (1ULL << ssd->height) - 1;
+    }
+
+    if (mask == 0) {
+        return;
+    }
+
+    for (int i = start; i < end; i++) {
+        const uint8_t *source = bitmap + i * bytes_per_column;
+        uint8_t *column = ssd->ram_buffer + 1 + (x + i) * ssd->pages;
+        uint64_t bits = 0;
+        uint64_t current = 0;
+
+        for (int b = 0; b < bytes_per_column; b++) {
+            bits |= (uint64_t) source[b] << (8 * b);
+        }
+        bits = y >= 0 ? bits << y : bits >> -y;
+
+        for (int page = 0; page < ssd->pages; page++) {
+            current |= (uint64_t) column[page] << (8 * page);
+        }
+
+        current = (current & ~mask) | (bits & mask);
+
+        for (int page = 0; page < ssd->pages; page++) {
+            column[page] = current >> (8 * page);
+        }
+    }
+}
+
+// Desenha o bitmap (a ser fornecido em display_oled.c) no display: copia a tela inteira e envia uma única vez
+void ssd1306_draw_bitmap(ssd1306_t *ssd, const uint8_t *bitmap) {
+    memcpy(ssd->ram_buffer + 1, bitmap, ssd->bufsize - 1);
+
+    ssd1306_send_data(ssd);
+}
+
+// Desenha um bitmap menor que a tela (ícone) em (x, y) e envia apenas as colunas que ele ocupa
+void ssd1306_draw_bitmap_window(ssd1306_t *ssd, const uint8_t *bitmap, int x, int y, int width, int height) {
+    int start_column = x < 0 ? 0 : x;
+    int end_column = x + width - 1 >= ssd->width ? ssd->width - 1 : x + width - 1;
+
+    if (start_column > end_column) {
+        return;
+    }
+
+    ssd1306_blit(ssd, bitmap, x, y, width, height);
+    ssd1306_send_columns(ssd, start_column, end_column);
+}
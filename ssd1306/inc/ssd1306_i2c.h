@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+
+#ifndef ssd1306_inc_h
+#define ssd1306_inc_h
+
+#define ssd1306_height 64 // Define a altura do display (32 pixels)
+#define ssd1306_width 128 // Define a largura do display (128 pixels)
+
+#define ssd1306_i2c_address _u(0x3C) // Define o endereço do i2c do display
+
+#define ssd1306_i2c_clock 400 // Define o tempo do clock (pode ser aumentado)
+#define ssd1306_i2c_clock_fast_plus 1000 // Fast-mode Plus (1 MHz), para painéis e pull-ups que o suportem
+
+#define ssd1306_max_displays 2 // Instâncias criadas com ssd1306_display_init (além da instância padrão)
+
+// Comandos de configuração (endereços)
+#define ssd1306_set_memory_mode _u(0x20)
+#define ssd1306_set_column_address _u(0x21)
+#define ssd1306_set_page_address _u(0x22)
+#define ssd1306_set_horizontal_scroll _u(0x26)
+#define ssd1306_set_scroll _u(0x2E)
+
+#define ssd1306_set_display_start_line _u(0x40)
+
+#define ssd1306_set_contrast _u(0x81)
+#define ssd1306_set_charge_pump _u(0x8D)
+
+#define ssd1306_set_segment_remap _u(0xA0)
+#define ssd1306_set_entire_on _u(0xA4)
+#define ssd1306_set_all_on _u(0xA5)
+#define ssd1306_set_normal_display _u(0xA6)
+#define ssd1306_set_inverse_display _u(0xA7)
+#define ssd1306_set_mux_ratio _u(0xA8)
+#define ssd1306_set_display _u(0xAE)
+#define ssd1306_set_common_output_direction _u(0xC0)
+#define ssd1306_set_common_output_direction_flip _u(0xC0)
+
+#define ssd1306_set_display_offset _u(0xD3)
+#define ssd1306_set_display_clock_divide_ratio _u(0xD5)
+#define ssd1306_set_precharge _u(0xD9)
+#define ssd1306_set_common_pin_configuration _u(0xDA)
+#define ssd1306_set_vcomh_deselect_level _u(0xDB)
+
+#define ssd1306_page_height 8
+#define ssd1306_n_pages (ssd1306_height / ssd1306_page_height)
+#define ssd1306_buffer_length (ssd1306_n_pages * ssd1306_width)
+
+#define ssd1306_command_list_max 32 // Máximo de comandos por transação i2c em ssd1306_send_command_list
+
+// Palavras na fila do envio assíncrono: quadro completo mais preâmbulo e byte de controle de cada página
+#define ssd1306_async_max_words (ssd1306_buffer_length + ssd1306_n_pages * 8)
+
+#define ssd1306_write_mode _u(0xFE)
+#define ssd1306_read_mode _u(0xFF)
+
+struct render_area {
+    uint8_t start_column;
+    uint8_t end_column;
+    uint8_t start_page;
+    uint8_t end_page;
+
+    int buffer_length;
+};
+
+// Framebuffer com o byte de controle (0x40) reservado logo antes dos dados, como em ssd1306_t::ram_buffer,
+// permitindo que os quadros sigam direto para o i2c_write_blocking sem cópia. Nos envios bloqueantes
+// (render_frame_on_display, ssd1306_display_render e o console), o byte anterior a cada janela enviada (control
+// ou um byte do próprio buffer) vale 0x40 durante a transação e é restaurado em seguida: até o retorno, o
+// buffer não pode ser lido nem alterado por outro núcleo ou por uma interrupção. Buffers sem esse byte
+// reservado (render_on_display) são copiados. Os envios assíncronos copiam os dados para a fila do DMA e não
+// alteram o buffer
+typedef struct {
+  uint8_t control;
+  uint8_t buffer[ssd1306_buffer_length];
+} ssd1306_frame_t;
+
+// Modos de composição de ssd1306_blit_char/ssd1306_blit_string
+enum ssd1306_blit_mode {
+    ssd1306_blit_copy,    // Substitui a célula 8x8 do glifo (como ssd1306_draw_char)
+    ssd1306_blit_or,      // Acende os pixels do glifo, preservando o fundo
+    ssd1306_blit_and_not, // Apaga os pixels do glifo (texto "vazado" sobre áreas preenchidas)
+    ssd1306_blit_xor,     // Inverte os pixels do glifo
+};
+
+// Faixa de colunas de cada página (start_column > end_column indica página vazia)
+struct ssd1306_page_spans {
+    uint8_t start_column[ssd1306_n_pages];
+    uint8_t end_column[ssd1306_n_pages];
+};
+
+// Campo de texto: uma linha de até ssd1306_text_field_max_columns caracteres em (x, y), que guarda o
+// conteúdo desenhado para redesenhar apenas as células que mudarem
+#define ssd1306_text_field_max_columns (ssd1306_width / 8)
+
+struct ssd1306_text_field {
+    int16_t x, y;
+    uint8_t columns; // Largura do campo em caracteres
+    uint8_t length; // Caracteres (Latin-1) desenhados atualmente
+    bool valid; // false força o redesenho de todas as células no próximo envio de texto
+    uint8_t cells[ssd1306_text_field_max_columns];
+};
+
+// Console de texto com rolagem por hardware: cada linha ocupa uma página da GDDRAM, usada como anel, e a
+// rolagem muda apenas a linha inicial do display (ssd1306_set_display_start_line)
+struct ssd1306_console {
+    uint8_t *ssd; // Framebuffer com o layout da tela inteira
+    uint8_t lines; // Linhas visíveis (páginas do display)
+    uint8_t top; // Página da GDDRAM exibida no topo
+    uint8_t count; // Linhas escritas até a tela encher
+    bool active;
+};
+
+// Estatísticas dos envios do framebuffer (bytes de dados enviados e economizados em relação ao quadro completo)
+// e duração de cada envio no barramento, da primeira escrita ao STOP final
+struct ssd1306_flush_stats {
+    uint32_t flushes;
+    uint32_t last_bytes_sent;
+    uint32_t last_bytes_saved;
+    uint64_t total_bytes_sent;
+    uint64_t total_bytes_saved;
+    uint32_t last_time_us;
+    uint32_t max_time_us;
+    uint64_t total_time_us;
+    uint32_t timed_flushes; // Envios com dados, cuja duração está somada em total_time_us
+};
+
+// Contadores de transações i2c e bytes enviados ao display, para medir o custo no barramento
+struct ssd1306_bus_stats {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t aborts; // Envios assíncronos interrompidos (ex.: NACK do display)
+};
+
+// Chamada ao fim de um envio assíncrono (em contexto de interrupção)
+typedef void (*ssd1306_async_callback_t)(void *user_data);
+
+// Chamada repetidamente enquanto o driver espera pelo barramento; deve voltar depois de pouco tempo
+typedef void (*ssd1306_wait_hook_t)(void);
+
+// Identifica quem toma o barramento (aninhamento e exclusão). Sem hook, o dono é o núcleo, o que só vale sem
+// sistema operacional: sob o FreeRTOS SMP uma tarefa preemptada no meio de um envio pode voltar no outro
+// núcleo e esperaria por si mesma, e duas tarefas do mesmo núcleo seriam tratadas como uma. Com o FreeRTOS,
+// retorne xTaskGetCurrentTaskHandle()
+typedef void *(*ssd1306_owner_hook_t)(void);
+
+// Instância de display na API de páginas: porta, endereço, geometria e velocidade do barramento, além do
+// rastreamento de regiões alteradas e das estatísticas próprias. O framebuffer sempre usa o layout de
+// ssd1306_frame_t (ssd1306_width colunas por página); apenas as primeiras width colunas e height / 8
+// páginas são enviadas
+typedef struct {
+    i2c_inst_t *i2c;
+    uint8_t address;
+    uint8_t width, height, pages;
+    uint32_t bus_khz;
+    ssd1306_frame_t *frame; // NULL na instância padrão, que aceita qualquer buffer
+    struct ssd1306_page_spans dirty; // Colunas alteradas em cada página desde o último envio
+    struct ssd1306_page_spans used; // Colunas com conteúdo desde a última limpeza do buffer
+    struct ssd1306_flush_stats flush_stats;
+    struct ssd1306_bus_stats bus_stats;
+    uint32_t flush_start_us;
+} ssd1306_display_t;
+
+typedef struct {
+  uint8_t width, height, pages, address;
+  i2c_inst_t * i2c_port;
+  bool external_vcc;
+  uint8_t *ram_buffer;
+  size_t bufsize;
+  uint8_t port_buffer[2];
+} ssd1306_t;
+
+#endif
\ No newline at end of file
@@ -83,7 +83,15 @@
  #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
  
  /* Run time and task stats gathering related definitions. */
- #define configGENERATE_RUN_TIME_STATS           0
+ /* Tempo de execução das tarefas em microssegundos, para o tempo ocioso em /metrics */
+ #define configGENERATE_RUN_TIME_STATS           1
+ #define configRUN_TIME_COUNTER_TYPE             uint64_t
+ #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+ #define portGET_RUN_TIME_COUNTER_VALUE()        time_us_64()
+ #ifndef __ASSEMBLER__
+ #include <stdint.h>
+ extern uint64_t time_us_64(void);
+ #endif
  #define configUSE_TRACE_FACILITY                1
  #define configUSE_STATS_FORMATTING_FUNCTIONS    0
  
@@ -6,10 +6,13 @@
 #include <math.h>
 #include "hardware/adc.h"
 #include "hardware/i2c.h"
+#include "hardware/sync.h"
 #include "inc/ssd1306.h"
+#include "inc/httpd.h"
+#include "web_assets.h"
 #include "FreeRTOS.h"
 #include "task.h"
-#include "semphr.h"
+#include "queue.h"
 
 #define LED_PIN 13         
 #define BUTTON1_PIN 5     
@@ -20,25 +23,61 @@ const float SOUND_OFFSET = 1.65f;
 const float SOUND_THRESHOLD_LOW = 0.02f;
 const float SOUND_THRESHOLD_MEDIUM = 0.7f; 
 const float SOUND_THRESHOLD_HIGH = 1.3f;
-float MAX_SOUND = 0.0f;
+const int EVENT_MIN_INTERVAL_MS = 50; // Intervalo mínimo entre eventos de /events (no máximo 20 por segundo)
 #define WIFI_SSID "REDE WIFI"    
 #define WIFI_PASS "SENHA WIFI"
 
-SemaphoreHandle_t xMutex;
-char button_message[50] = "Botão sem interação";
-float current_sound_level = 0.0f;
-char sound_message[50] = "Nenhum som captado!";
-
-char http_response[1024];
-uint8_t ssd[ssd1306_buffer_length];
+// Estados publicados em /api/status como códigos; a página traduz cada código na mensagem correspondente
+enum { button_idle, button_down, button_up };
+enum { sound_none, sound_low, sound_medium, sound_high };
+
+// Estado compartilhado entre as tarefas, publicado por seqlock. Só a tarefa do botão escreve (check_sound_trigger
+// roda nela): status_seqlock fica ímpar durante a escrita, feita numa seção crítica curta. Os leitores
+// (servidor, eventos e display, em qualquer núcleo) copiam o estado inteiro e repetem a cópia se uma escrita a
+// atravessou. Com threadsafe_background o servidor lê numa interrupção; como a escrita não pode ser
+// interrompida no seu núcleo, o leitor só repete enquanto o outro núcleo termina a escrita
+struct status_state {
+    uint32_t sequence; // Incrementado a cada mudança: eventos de /events e ETag de /api/status
+    int button;
+    int sound;
+    float level;
+    float max; // Maior nível desde o último toque no botão
+};
+
+static struct status_state status_state = { .button = button_idle, .sound = sound_none };
+static volatile uint32_t status_seqlock = 0;
+
+ssd1306_frame_t ssd_frame;
+uint8_t *ssd = ssd_frame.buffer;
 struct render_area frame_area;
+bool display_flush_pending = false;
+struct ssd1306_text_field sound_field;
+struct ssd1306_text_field max_sound_field;
+int bar_width_drawn = 0;
+
+// Até o primeiro toque no botão, o display mostra o log de inicialização em um console com rolagem por
+// hardware. Só a tarefa do display escreve no OLED: as demais enviam as linhas pela fila
+struct ssd1306_console console;
+QueueHandle_t log_queue;
+typedef struct { char text[17]; } log_line_t;
 
 void wifi_connection_task(void *pvParameters);
 void button_monitor_task(void *pvParameters);
 void http_server_task(void *pvParameters);
 void display_update_task(void *pvParameters);
 
+// Espera do driver do display pelo barramento: bloqueia a tarefa por um tick em vez de ocupar o núcleo
+static void display_wait() {
+    vTaskDelay(1);
+}
+
+// Dono do barramento do display: a tarefa, que pode mudar de núcleo no meio de um envio
+static void *display_owner() {
+    return xTaskGetCurrentTaskHandle();
+}
+
 void init_display() {
+    ssd1306_set_wait_hook(display_wait, display_owner);
     i2c_init(i2c1, ssd1306_i2c_clock * 1000);
     gpio_set_function(14, GPIO_FUNC_I2C); 
     gpio_set_function(15, GPIO_FUNC_I2C); 
@@ -54,7 +93,29 @@ void init_display() {
     calculate_render_area_buffer_length(&frame_area);
     
     memset(ssd, 0, ssd1306_buffer_length);
-    render_on_display(ssd, &frame_area);
+    ssd1306_console_init(&console, ssd);
+    ssd1306_console_print(&console, "Iniciando...");
+}
+
+// Encerra o console e desenha a parte fixa da tela de som
+void init_sound_screen() {
+    ssd1306_console_end(&console);
+    ssd1306_text_field_init(&sound_field, 4, 16, 15);
+    ssd1306_text_field_init(&max_sound_field, 4, 24, 15);
+    ssd1306_draw_rect(ssd, 4, 40, 120, 10, true); // Contorno fixo da barra de nível
+    bar_width_drawn = 0;
+    render_frame_on_display(&ssd_frame, &frame_area);
+}
+
+// Envia uma linha ao console do display, sem bloquear; depois que o console é encerrado, nada é enviado
+void log_display(const char *text) {
+    log_line_t line;
+
+    if (!console.active) {
+        return;
+    }
+    snprintf(line.text, sizeof(line.text), "%s", text);
+    xQueueSend(log_queue, &line, 0);
 }
 
 void init_led_button(){
@@ -69,99 +130,171 @@ void init_led_button(){
     adc_select_input(2);
 }
 
+// Chamada pela interrupção do i2c ao fim do envio do quadro: notifica a tarefa do display
+void display_flush_done(void *user_data) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+
+    vTaskNotifyGiveFromISR((TaskHandle_t) user_data, &higher_priority_task_woken);
+    portYIELD_FROM_ISR(higher_priority_task_woken);
+}
+
 void update_display_sound(float level, float max) {
-    memset(ssd, 0, ssd1306_buffer_length);
-    char sound_str[20];
-    char max_sound_str[20];
-    
-    snprintf(sound_str, sizeof(sound_str), "Som: %.2f V", level);
-    ssd1306_draw_string(ssd, 4, 16, sound_str);
+    // Os campos só redesenham os caracteres que mudaram; sem mudanças, nada é marcado para envio
+    ssd1306_text_field_printf(ssd, &sound_field, "Som: %.2f V", level);
     if (max > 0.0f) {
-        snprintf(max_sound_str, sizeof(max_sound_str), "Maior som: %.2f V", max); 
-        ssd1306_draw_string(ssd, 4, 24, max_sound_str);
+        ssd1306_text_field_printf(ssd, &max_sound_field, "Maior som: %.2f V", max);
     }
-    
-    render_on_display(ssd, &frame_area);
+    else {
+        ssd1306_text_field_set(ssd, &max_sound_field, "");
+    }
+
+    // Barra de nível proporcional ao som atual (escala de 0 a SOUND_OFFSET): apenas a diferença para a
+    // largura já desenhada é preenchida ou apagada
+    int bar_width = (int)(level / SOUND_OFFSET * 118.0f);
+    if (bar_width > 118) bar_width = 118;
+    if (bar_width > bar_width_drawn) {
+        ssd1306_fill_rect(ssd, 5 + bar_width_drawn, 41, bar_width - bar_width_drawn, 8, true);
+    }
+    else if (bar_width < bar_width_drawn) {
+        ssd1306_clear_rect(ssd, 5 + bar_width, 41, bar_width_drawn - bar_width, 8);
+    }
+    bar_width_drawn = bar_width;
+
+    // O quadro anterior ainda pode estar no barramento: aguarda a notificação sem ocupar a CPU.
+    // Se nada mudou, render_on_display_async não envia nada e retorna false
+    if (display_flush_pending) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    display_flush_pending = render_on_display_async(ssd, &frame_area, display_flush_done, xTaskGetCurrentTaskHandle());
+}
+
+// Estado em JSON: {"button":1,"sound":2,"level":0.42,"max":0.91}
+enum { field_status };
+
+static const struct httpd_chunk status_json_chunks[] = {
+    httpd_field(field_status),
+};
+
+// no-cache: o navegador guarda a resposta e a revalida pelo ETag, recebendo 304 enquanto o estado não muda
+static const struct httpd_template status_json = httpd_template("application/json", "Cache-Control: no-cache\r\n", status_json_chunks);
+
+// Tarefa que envia o estado a /events, avisada a cada mudança (NULL até o servidor subir)
+static volatile TaskHandle_t event_task = NULL;
+static volatile uint32_t event_wakeups = 0;
+
+// Escrita do estado pela tarefa do botão: os campos de status_state mudam entre as duas chamadas, com as
+// interrupções desligadas no núcleo (um leitor na interrupção do lwIP esperaria para sempre pela escrita
+// que interrompeu)
+static void status_write_begin() {
+    taskENTER_CRITICAL();
+    status_seqlock++;
+    __dmb();
+}
+
+static void status_write_end() {
+    __dmb();
+    status_seqlock++;
+    taskEXIT_CRITICAL();
+
+    if (event_task) {
+        xTaskNotifyGive(event_task);
+    }
+}
+
+// Cópia consistente do estado, para formatar e enviar sem segurar nada
+static void take_status_snapshot(struct status_state *snapshot) {
+    uint32_t begin;
+
+    do {
+        begin = status_seqlock;
+        __dmb();
+        *snapshot = status_state;
+        __dmb();
+    } while ((begin & 1) || status_seqlock != begin);
 }
 
-void create_http_response() {
-    if (xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE) {
-        snprintf(http_response, sizeof(http_response),
-                "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=UTF-8\r\n\r\n"
-                "<!DOCTYPE html>"
-                "<html>"
-                "<head>"
-                "  <meta charset=\"UTF-8\">"
-                "  <title>Microfone</title>"
-                "  <meta http-equiv=\"refresh\" content=\"1\">"
-                "  <style>"
-                "    body {"
-                "      font-family: Arial, sans-serif;"
-                "      background-color: #0066cc;"
-                "      margin: 0;"
-                "      padding: 20px;"
-                "      display: flex;"
-                "      flex-direction: column;"
-                "      align-items: center;"
-                "      justify-content: center;"
-                "      min-height: 100vh;"
-                "      color: white;"
-                "    }"
-                "    a {"
-                "      color: white;"
-                "      text-decoration: none;"
-                "    }"
-                "  </style>"
-                "</head>"
-                "<body>"
-                "  <h1>Controle do Microfone</h1>"
-                "    <h2>Estado do Botão:</h2>"
-                "    <p>%s</p>"
-                "    <h2>Nível do Som:</h2>"
-                "    <p>%s</p>"
-                "    <p>Nível atual: %.2f V</p>"
-                "    <p>Máximo captado: %.2f V</p>"
-                "  <p><a href=\"/\">Atualizar</a></p>"
-                "</body>"
-                "</html>\r\n",
-                button_message, sound_message, current_sound_level, MAX_SOUND);
-        xSemaphoreGive(xMutex);
+static int write_status_field(int id, char *buffer, int size, void *arg) {
+    const struct status_state *snapshot = arg;
+
+    return snprintf(buffer, size, "{\"button\":%d,\"sound\":%d,\"level\":%.2f,\"max\":%.2f}",
+                    snapshot->button, snapshot->sound, snapshot->level, snapshot->max);
+}
+
+static err_t handle_status(struct httpd_connection *connection, const struct httpd_request *request) {
+    struct status_state snapshot;
+
+    take_status_snapshot(&snapshot);
+    if (httpd_set_version(connection, request, snapshot.sequence)) {
+        return httpd_send_not_modified(connection, status_json.headers);
     }
+    return httpd_send_template(connection, &status_json, write_status_field, &snapshot);
 }
 
-static err_t http_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
-    if (p == NULL) {
-        tcp_close(tpcb);
-        return ERR_OK;
+// Métricas do projeto para /metrics, seguidas das do servidor e do lwIP (httpd_write_metrics). Cada linha lê o
+// estado na hora em que é gerada
+static int write_metric(int index, char *buffer, int size, void *arg) {
+    struct status_state snapshot;
+    // Durações medidas pelo driver, do início do envio no barramento ao STOP final
+    const struct ssd1306_flush_stats *flush = ssd1306_get_flush_stats();
+
+    if (index < 5) {
+        take_status_snapshot(&snapshot);
+    }
+
+    switch (index) {
+        case 0: return httpd_format_metric(buffer, size, "status_sound_level_volts", "gauge", "Nível atual do som", snapshot.level);
+        case 1: return httpd_format_metric(buffer, size, "status_sound_max_volts", "gauge", "Maior nível desde o último toque no botão", snapshot.max);
+        case 2: return httpd_format_metric(buffer, size, "status_sound_intensity", "gauge", "Faixa do maior nível (0 a 3)", snapshot.sound);
+        case 3: return httpd_format_metric(buffer, size, "status_button", "gauge", "Estado do botão (0 sem interação, 1 pressionado, 2 solto)", snapshot.button);
+        case 4: return httpd_format_metric(buffer, size, "status_changes_total", "counter", "Mudanças do estado", snapshot.sequence);
+        case 5: return httpd_format_metric(buffer, size, "freertos_heap_free_bytes", "gauge", "Heap livre do FreeRTOS", xPortGetFreeHeapSize());
+        case 6: return httpd_format_metric(buffer, size, "freertos_heap_min_free_bytes", "gauge", "Menor heap livre desde o boot", xPortGetMinimumEverFreeHeapSize());
+        case 7: return httpd_format_metric(buffer, size, "display_flush_last_seconds", "gauge", "Duração do último envio do quadro ao display", flush->last_time_us / 1e6);
+        case 8: return httpd_format_metric(buffer, size, "display_flush_max_seconds", "gauge", "Maior duração de um envio desde o boot", flush->max_time_us / 1e6);
+        case 9: return httpd_format_metric(buffer, size, "freertos_idle_seconds_total", "counter", "Tempo nas tarefas ociosas, somado entre os núcleos", ulTaskGetIdleRunTimeCounter() / 1e6);
+        case 10: return httpd_format_metric(buffer, size, "status_event_wakeups_total", "counter", "Vezes em que a tarefa de /events acordou", event_wakeups);
+        case 11:
+            return snprintf(buffer, size, "# HELP display_flush_seconds Envios do quadro ao display\n"
+                                          "# TYPE display_flush_seconds summary\n"
+                                          "display_flush_seconds_sum %.6f\n"
+                                          "display_flush_seconds_count %lu\n",
+                            flush->total_time_us / 1e6, (unsigned long) flush->timed_flushes);
+        default: return httpd_write_metrics(index - 12, buffer, size);
     }
-    char *request = (char *)p->payload;
-    create_http_response();
-    tcp_write(tpcb, http_response, strlen(http_response), TCP_WRITE_FLAG_COPY);
-    pbuf_free(p);
-    return ERR_OK;
 }
 
-static err_t connection_callback(void *arg, struct tcp_pcb *newpcb, err_t err) {
-    tcp_recv(newpcb, http_callback); 
-    return ERR_OK;
+// /metrics no formato de exposição em texto do Prometheus, gerado linha a linha no buffer de envio
+static err_t handle_metrics(struct httpd_connection *connection, const struct httpd_request *request) {
+    return httpd_send_stream(connection, "text/plain; version=0.0.4; charset=utf-8", "Cache-Control: no-store\r\n", write_metric, NULL);
 }
 
+// Fluxo de Server-Sent Events: a conexão fica aberta e recebe o estado a cada mudança (push_status_event)
+static err_t handle_events(struct httpd_connection *connection, const struct httpd_request *request) {
+    return httpd_begin_events(connection);
+}
+
+// A página (web/) é servida pelos arquivos estáticos: busca o estado em /api/status e depois recebe as
+// mudanças pelo fluxo de /events
+static const struct httpd_route routes[] = {
+    {"GET", "/api/status", handle_status},
+    {"GET", "/events", handle_events},
+    {"GET", "/metrics", handle_metrics},
+};
+
+static const struct httpd_server server = httpd_server_with_assets(routes, web_assets);
+
 static void start_http_server(void) {
-    struct tcp_pcb *pcb = tcp_new();
-    if (!pcb) {
-        printf("Erro ao criar PCB\n");
-        return;
-    }
+    cyw43_arch_lwip_begin();
+    err_t err = httpd_start(&server, 80);
+    cyw43_arch_lwip_end();
 
-    if (tcp_bind(pcb, IP_ADDR_ANY, 80) != ERR_OK) {
+    if (err != ERR_OK) {
         printf("Erro ao ligar o servidor na porta 80\n");
         return;
     }
 
-    pcb = tcp_listen(pcb);  
-    tcp_accept(pcb, connection_callback);  
-
     printf("Servidor HTTP rodando na porta 80...\n");
+    log_display("HTTP: porta 80");
 }
 
 void check_sound_trigger() {
@@ -169,32 +302,68 @@ void check_sound_trigger() {
     uint16_t raw_adc = adc_read();
     float voltage = (raw_adc * ADC_REF) / ADC_RES;
     
-    if (xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE) {
-        current_sound_level = fabs(voltage - SOUND_OFFSET);
+    float level = fabs(voltage - SOUND_OFFSET);
+    float max = level > status_state.max ? level : status_state.max;
 
-        if(current_sound_level > MAX_SOUND){
-            MAX_SOUND = current_sound_level;
-        }
+    if (level == status_state.level && max == status_state.max) {
+        return;
+    }
 
-        if (MAX_SOUND >= SOUND_THRESHOLD_HIGH) {
-            snprintf(sound_message, sizeof(sound_message), "Intensidade alta captada!");
-        } else if (MAX_SOUND >= SOUND_THRESHOLD_MEDIUM) {
-            snprintf(sound_message, sizeof(sound_message), "Intensidade média captada!");
-        } else if (MAX_SOUND >= SOUND_THRESHOLD_LOW) {
-            snprintf(sound_message, sizeof(sound_message), "Intensidade baixa captada!");
-        } else {
-            snprintf(sound_message, sizeof(sound_message), "Nenhum som captado!");
-        }
-        xSemaphoreGive(xMutex);
+    status_write_begin();
+    status_state.level = level;
+    status_state.max = max;
+    if (max >= SOUND_THRESHOLD_HIGH) {
+        status_state.sound = sound_high;
+    } else if (max >= SOUND_THRESHOLD_MEDIUM) {
+        status_state.sound = sound_medium;
+    } else if (max >= SOUND_THRESHOLD_LOW) {
+        status_state.sound = sound_low;
+    } else {
+        status_state.sound = sound_none;
     }
+    status_state.sequence++;
+    status_write_end();
 }
 
 
+// Envia o estado aos clientes de /events quando ele muda, no máximo a cada EVENT_MIN_INTERVAL_MS; mudanças
+// dentro do intervalo seguem juntas no próximo evento. A tarefa do Wi-Fi só acorda quando status_write_end
+// avisa, e trava o lwIP para enviar
+void push_status_event() {
+    static uint32_t sent_sequence = 0;
+    static absolute_time_t next_event;
+    struct status_state snapshot;
+    char data[96];
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    event_wakeups++;
+
+    int64_t wait_us = absolute_time_diff_us(get_absolute_time(), next_event);
+    if (wait_us > 0) {
+        vTaskDelay(pdMS_TO_TICKS((wait_us + 999) / 1000));
+    }
+
+    take_status_snapshot(&snapshot);
+    if (snapshot.sequence == sent_sequence) {
+        return;
+    }
+    sent_sequence = snapshot.sequence;
+    next_event = make_timeout_time_ms(EVENT_MIN_INTERVAL_MS);
+
+    cyw43_arch_lwip_begin();
+    if (httpd_event_clients() > 0) {
+        write_status_field(0, data, sizeof(data), &snapshot);
+        httpd_send_event(data);
+    }
+    cyw43_arch_lwip_end();
+}
+
 void wifi_connection_task(void *pvParameters) {
     printf("Iniciando servidor HTTP\n");
 
     if (cyw43_arch_init()) {
         printf("Erro ao inicializar o Wi-Fi\n");
+        log_display("Wi-Fi: erro");
         vTaskDelete(NULL);
     }
 
@@ -202,23 +371,32 @@ void wifi_connection_task(void *pvParameters) {
 
     while (true) {
         printf("Conectando ao Wi-Fi...\n");
+        log_display("Wi-Fi: conectando");
 
         if (cyw43_arch_wifi_connect_timeout_ms(WIFI_SSID, WIFI_PASS, CYW43_AUTH_WPA2_AES_PSK, 10000) == 0) {
             printf("Conectado!\n");
             uint8_t *ip_address = (uint8_t*)&(cyw43_state.netif[0].ip_addr.addr);
             printf("Endereço IP: %d.%d.%d.%d\n", ip_address[0], ip_address[1], ip_address[2], ip_address[3]);
+
+            char ip_line[17];
+            snprintf(ip_line, sizeof(ip_line), "%d.%d.%d.%d", ip_address[0], ip_address[1], ip_address[2], ip_address[3]);
+            log_display("Conectado! IP:");
+            log_display(ip_line);
             break; 
         } else {
             printf("Falha ao conectar. Tentando novamente em 5 segundos...\n");
+            log_display("Wi-Fi: falha");
             vTaskDelay(pdMS_TO_TICKS(5000));
         }
     }
 
     start_http_server();
 
+    // A rede não precisa de polling aqui: o lwIP roda nas interrupções do cyw43 ou na thread tcpip
+    // (STATUS_SERVER_LWIP_FREERTOS)
+    event_task = xTaskGetCurrentTaskHandle();
     while (true) {
-        cyw43_arch_poll();
-        vTaskDelay(pdMS_TO_TICKS(10));
+        push_status_event();
     }
 }
 
@@ -231,20 +409,20 @@ void button_monitor_task(void *pvParameters) {
         bool button_state = !gpio_get(BUTTON1_PIN);
 
         if (button_state && !button_last_state) {
-            if (xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE) {
-                gpio_put(LED_PIN, 1);
-                snprintf(button_message, sizeof(button_message), "Botão pressionado!");
-                MAX_SOUND = 0.0f;
-                xSemaphoreGive(xMutex);
-            }
+            gpio_put(LED_PIN, 1);
+            status_write_begin();
+            status_state.button = button_down;
+            status_state.max = 0.0f;
+            status_state.sequence++;
+            status_write_end();
             button_pressed = true;
         } 
         else if (!button_state && button_last_state) {
-            if (xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE) {
-                gpio_put(LED_PIN, 0);
-                snprintf(button_message, sizeof(button_message), "Botão solto!");
-                xSemaphoreGive(xMutex);
-            }
+            gpio_put(LED_PIN, 0);
+            status_write_begin();
+            status_state.button = button_up;
+            status_state.sequence++;
+            status_write_end();
             button_pressed = false;
         }
 
@@ -260,13 +438,25 @@ void button_monitor_task(void *pvParameters) {
 
 void display_update_task(void *pvParameters) {
     init_display();
-    
+
+    // Console de inicialização: cada linha recebida rola a tela; o primeiro toque no botão o encerra
+    while (console.active) {
+        log_line_t line;
+
+        if (xQueueReceive(log_queue, &line, pdMS_TO_TICKS(100)) == pdTRUE) {
+            ssd1306_console_print(&console, line.text);
+        }
+        if (!gpio_get(BUTTON1_PIN)) {
+            init_sound_screen();
+        }
+    }
+
     while (true) {
-        if (xSemaphoreTake(xMutex, portMAX_DELAY) == pdTRUE) {
-            if (!gpio_get(BUTTON1_PIN)) { 
-                update_display_sound(current_sound_level, MAX_SOUND );
-            }
-            xSemaphoreGive(xMutex);
+        struct status_state snapshot;
+
+        if (!gpio_get(BUTTON1_PIN)) { 
+            take_status_snapshot(&snapshot);
+            update_display_sound(snapshot.level, snapshot.max);
         }
         vTaskDelay(pdMS_TO_TICKS(100));
     }
@@ -276,9 +466,9 @@ int main() {
     stdio_init_all();
     sleep_ms(10000); 
 
-    xMutex = xSemaphoreCreateMutex();
-    if (xMutex == NULL) {
-        printf("Erro ao criar mutex\n");
+    log_queue = xQueueCreate(8, sizeof(log_line_t));
+    if (log_queue == NULL) {
+        printf("Erro ao criar fila do log\n");
         return 1;
     }
 
@@ -0,0 +1,25 @@
+// Busca o estado em /api/status e depois recebe as mudanças pelo fluxo de /events (sem EventSource, volta a
+// buscar a cada segundo)
+const buttons = ['Botão sem interação', 'Botão pressionado!', 'Botão solto!'];
+const sounds = ['Nenhum som captado!', 'Intensidade baixa captada!',
+                'Intensidade média captada!', 'Intensidade alta captada!'];
+const show = (id, text) => document.getElementById(id).textContent = text;
+
+function render(status) {
+  show('button', buttons[status.button]);
+  show('sound', sounds[status.sound]);
+  show('level', status.level.toFixed(2));
+  show('max', status.max.toFixed(2));
+}
+
+async function update() {
+  try {
+    render(await (await fetch('/api/status')).json());
+  } catch (e) {}
+  if (!window.EventSource) setTimeout(update, 1000);
+}
+
+update();
+if (window.EventSource) {
+  new EventSource('/events').onmessage = (event) => render(JSON.parse(event.data));
+}
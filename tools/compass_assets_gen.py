@@ -0,0 +1,248 @@
+#!/usr/bin/env python3
+# Gera o cabeçalho de assets do compass_rose a partir de compass_rose/img/*.png:
+#  - um ícone da rosa dos ventos por direção, reduzido a ICON_SIZE x ICON_SIZE pixels e gravado no layout de
+#    páginas do SSD1306 (um byte por coluna, bit menos significativo no topo), comprimido em RLE para ser
+#    decodificado direto no framebuffer por ssd1306_draw_rle;
+#  - as máscaras da matriz 5x5 de LEDs WS2812, um uint32_t por direção com o bit i aceso para o LED i.
+#
+# Formato RLE: cada bloco começa com um byte de controle n. Com o bit 7 aceso, o byte seguinte se repete
+# (n & 0x7F) + 1 vezes; caso contrário seguem n + 1 bytes literais. Os bytes cobrem as páginas do ícone em
+# sequência, da esquerda para a direita.
+#
+# Usa apenas a biblioteca padrão (o PNG é decodificado com zlib).
+#
+# Uso: python3 tools/compass_assets_gen.py <diretório das imagens> <saida.h>
+
+import struct
+import sys
+import zlib
+
+ICON_SIZE = 64
+
+# Luminância abaixo da qual um pixel da imagem conta como traço; a marca d'água clara fica de fora
+DARK_LEVEL = 96
+
+# Fração de pixels escuros de um bloco para acender o pixel reduzido
+COVERAGE = 0.3
+
+# Direções: (imagem, nome no C, padrão da matriz de LEDs, linha 0 em cima). Os padrões reproduzem os antigos
+# vetores de direction.h, inclusive as diagonais espelhadas como o joystick as lê
+DIRECTIONS = [
+    ('N', 'norte', ['..#..', '.#.#.', '#...#', '.....', '.....']),
+    ('S', 'sul', ['.....', '.....', '#...#', '.#.#.', '..#..']),
+    ('E', 'leste', ['..#..', '...#.', '....#', '...#.', '..#..']),
+    ('W', 'oeste', ['..#..', '.#...', '#....', '.#...', '..#..']),
+    ('NE', 'nordeste', ['###..', '#....', '#....', '.....', '.....']),
+    ('NW', 'noroeste', ['..###', '....#', '....#', '.....', '.....']),
+    ('SE', 'sudeste', ['.....', '.....', '....#', '....#', '..###']),
+    ('SW', 'sudoeste', ['.....', '.....', '#....', '#....', '###..']),
+    (None, 'centro', ['.....', '.....', '..#..', '.....', '.....']),
+]
+
+
+# Índice do LED na posição (coluna x, linha y): a matriz é ligada em zigue-zague a partir do LED 0, no canto
+# inferior esquerdo
+def led_index(x, y):
+    row = 4 - y
+    return row * 5 + (x if row % 2 == 0 else 4 - x)
+
+
+def led_mask(pattern):
+    mask = 0
+    for y, line in enumerate(pattern):
+        for x, ch in enumerate(line):
+            if ch == '#':
+                mask |= 1 << led_index(x, y)
+    return mask
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+# Decodifica um PNG de 8 bits por canal (cinza, RGB ou RGBA, sem entrelaçamento) em linhas de luminância,
+# com a transparência composta sobre fundo branco
+def read_png(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s: não é um PNG' % path)
+
+    pos, idat = 8, b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        if kind == b'IHDR':
+            width, height, depth, color, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'IDAT':
+            idat += chunk
+        pos += length + 12
+
+    channels = {0: 1, 2: 3, 4: 2, 6: 4}.get(color)
+    if depth != 8 or channels is None or interlace:
+        raise ValueError('%s: formato de PNG não suportado' % path)
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    previous = bytearray(stride)
+    rows = []
+    for y in range(height):
+        kind = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = previous[i]
+            c = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif kind == 4:
+                line[i] = (line[i] + paeth(a, b, c)) & 0xFF
+        previous = line
+
+        luma = []
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            gray = px[0] if channels <= 2 else (px[0] * 299 + px[1] * 587 + px[2] * 114) // 1000
+            alpha = px[-1] if channels in (2, 4) else 255
+            luma.append((gray * alpha + 255 * (255 - alpha)) // 255)
+        rows.append(luma)
+    return rows
+
+
+# Caixa quadrada que contém os traços de todas as imagens: o ícone fica na mesma posição em todas as direções
+def bounding_square(images):
+    x0 = y0 = 1 << 30
+    x1 = y1 = -1
+    for rows in images:
+        for y, line in enumerate(rows):
+            dark = [x for x, v in enumerate(line) if v < DARK_LEVEL]
+            if dark:
+                x0, x1 = min(x0, dark[0]), max(x1, dark[-1])
+                y0, y1 = min(y0, y), max(y1, y)
+    side = max(x1 - x0, y1 - y0) + 1
+    return (x0 + x1 + 1 - side) // 2, (y0 + y1 + 1 - side) // 2, side
+
+
+# Reduz a região quadrada a ICON_SIZE x ICON_SIZE pela fração de pixels escuros de cada bloco e monta as
+# páginas do SSD1306
+def icon_pages(rows, left, top, side):
+    height, width = len(rows), len(rows[0])
+    pixels = [[False] * ICON_SIZE for _ in range(ICON_SIZE)]
+    for iy in range(ICON_SIZE):
+        ya, yb = top + iy * side // ICON_SIZE, top + (iy + 1) * side // ICON_SIZE
+        for ix in range(ICON_SIZE):
+            xa, xb = left + ix * side // ICON_SIZE, left + (ix + 1) * side // ICON_SIZE
+            total = dark = 0
+            for y in range(max(ya, 0), min(yb, height)):
+                line = rows[y]
+                for x in range(max(xa, 0), min(xb, width)):
+                    total += 1
+                    dark += line[x] < DARK_LEVEL
+            pixels[iy][ix] = total > 0 and dark >= COVERAGE * total
+
+    pages = bytearray()
+    for page in range(ICON_SIZE // 8):
+        for x in range(ICON_SIZE):
+            pages.append(sum(pixels[page * 8 + bit][x] << bit for bit in range(8)))
+    return bytes(pages)
+
+
+def rle_encode(data):
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < 128:
+            run += 1
+        if run >= 3:
+            if literal:
+                out.append(len(literal) - 1)
+                out += literal
+                literal = bytearray()
+            out += bytes([0x80 | (run - 1), data[i]])
+            i += run
+            continue
+        literal.append(data[i])
+        i += 1
+        if len(literal) == 128:
+            out.append(len(literal) - 1)
+            out += literal
+            literal = bytearray()
+    if literal:
+        out.append(len(literal) - 1)
+        out += literal
+    return bytes(out)
+
+
+def rle_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        n = data[i]
+        if n & 0x80:
+            out += bytes([data[i + 1]]) * ((n & 0x7F) + 1)
+            i += 2
+        else:
+            out += data[i + 1:i + 2 + n]
+            i += n + 2
+    return bytes(out)
+
+
+def render(image_dir):
+    names = [image for image, _, _ in DIRECTIONS if image]
+    images = {image: read_png('%s/%s.png' % (image_dir, image)) for image in names}
+    left, top, side = bounding_square(images.values())
+
+    lines = [
+        '// Gerado por tools/compass_assets_gen.py a partir de img/*.png (não editar manualmente)',
+        '#ifndef compass_assets_h',
+        '#define compass_assets_h',
+        '',
+        '#include <stdint.h>',
+        '',
+        '// Ícones %dx%d no layout de páginas do SSD1306, comprimidos em RLE (ver ssd1306_draw_rle)' % (ICON_SIZE, ICON_SIZE),
+        '#define compass_icon_size %d' % ICON_SIZE,
+        '',
+    ]
+
+    raw_total = packed_total = 0
+    for image, name, _ in DIRECTIONS:
+        if not image:
+            continue
+        pages = icon_pages(images[image], left, top, side)
+        packed = rle_encode(pages)
+        assert rle_decode(packed) == pages
+        raw_total += len(pages)
+        packed_total += len(packed)
+
+        lines.append('static const uint8_t icon_%s[%d] = {' % (name, len(packed)))
+        for i in range(0, len(packed), 16):
+            lines.append('    ' + ', '.join('0x%02x' % b for b in packed[i:i + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+
+    lines.append('// %d bytes de ícones em RLE (%d sem compressão)' % (packed_total, raw_total))
+    lines.append('')
+    lines.append('// Máscaras da matriz 5x5: bit i aceso acende o LED i')
+    for _, name, pattern in DIRECTIONS:
+        lines.append('static const uint32_t leds_%s = 0x%07x;' % (name, led_mask(pattern)))
+    lines.append('')
+    lines.append('#endif')
+    return '\n'.join(lines) + '\n'
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit('uso: %s <diretório das imagens> <saida.h>' % sys.argv[0])
+    text = render(sys.argv[1])
+    with open(sys.argv[2], 'w', encoding='utf-8') as f:
+        f.write(text)
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+# Gera ssd1306/inc/ssd1306_font.h: tabela de glifos 8x8 indexada diretamente pelo código do caractere (0-255),
+# cobrindo ASCII imprimível e Latin-1. Cada glifo tem 8 bytes, um por coluna, com o bit menos
+# significativo no topo (formato das páginas do SSD1306). Códigos de controle ficam em branco.
+#
+# Uso: python3 tools/ssd1306_font_gen.py <saida.h> [<saida.h> ...]
+
+import sys
+
+# Glifos desenhados linha a linha ('#' aceso). Linhas e colunas omitidas ficam apagadas.
+# Maiúsculas usam as linhas 0-6; minúsculas têm altura-x nas linhas 2-6 e descendentes na linha 7.
+GLYPHS = {
+    ' ': [],
+    '!': ['...#', '...#', '...#', '...#', '...#', '', '...#'],
+    '"': ['..#.#', '..#.#', '..#.#'],
+    '#': ['..#.#', '..#.#', '#####', '..#.#', '#####', '..#.#', '..#.#'],
+    '$': ['...#', '.####', '#..#', '.###', '...#.#', '####', '...#'],
+    '%': ['##...#', '##..#', '...#', '..#', '.#..##', '#...##'],
+    '&': ['.##', '#..#', '#.#', '.#', '#.#.#', '#..#', '.##.#'],
+    "'": ['...#', '...#', '..#'],
+    '(': ['....#', '...#', '..#', '..#', '..#', '...#', '....#'],
+    ')': ['..#', '...#', '....#', '....#', '....#', '...#', '..#'],
+    '*': ['', '...#', '.#.#.#', '..###', '.#.#.#', '...#'],
+    '+': ['', '...#', '...#', '.#####', '...#', '...#'],
+    ',': ['', '', '', '', '', '...#', '...#', '..#'],
+    '-': ['', '', '', '.#####'],
+    '.': ['', '', '', '', '', '..##', '..##'],
+    '/': ['......#', '.....#', '....#', '...#', '..#', '.#', '#'],
+    ':': ['', '..##', '..##', '', '..##', '..##'],
+    ';': ['', '..##', '..##', '', '..##', '...#', '..#'],
+    '<': ['....#', '...#', '..#', '.#', '..#', '...#', '....#'],
+    '=': ['', '', '.#####', '', '.#####'],
+    '>': ['.#', '..#', '...#', '....#', '...#', '..#', '.#'],
+    '?': ['.####', '#....#', '.....#', '...##', '...#', '', '...#'],
+    '@': ['.#####', '#.....#', '#..####', '#.#..##', '#..###', '#', '.#####'],
+    '[': ['..###', '..#', '..#', '..#', '..#', '..#', '..###'],
+    '\\': ['#', '.#', '..#', '...#', '....#', '.....#', '......#'],
+    ']': ['..###', '....#', '....#', '....#', '....#', '....#', '..###'],
+    '^': ['...#', '..#.#', '.#...#'],
+    '_': ['', '', '', '', '', '', '#######'],
+    '`': ['..#', '...#'],
+    '{': ['....##', '...#', '...#', '..#', '...#', '...#', '....##'],
+    '|': ['...#', '...#', '...#', '...#', '...#', '...#', '...#'],
+    '}': ['.##', '...#', '...#', '....#', '...#', '...#', '.##'],
+    '~': ['', '', '.##..#', '#..##'],
+
+    # Glifos originais do driver (mantidos)
+    'A': ['...#....', '..#.#...', '.#...#..', '#.....#.', '#######.', '#.....#.', '#.....#.'],
+    'B': ['#######.', '#.....#.', '#.....#.', '#######.', '#.....#.', '#.....#.', '#######.'],
+    'C': ['.######.', '#.......', '#.......', '#.......', '#.......', '#.......', '#######.'],
+    'D': ['######..', '#.....#.', '#.....#.', '#.....#.', '#.....#.', '#.....#.', '#######.'],
+    'E': ['#######.', '#.......', '#.......', '#######.', '#.......', '#.......', '#######.'],
+    'F': ['#######.', '#.......', '#.......', '#####...', '#.......', '#.......', '#.......'],
+    'G': ['#######.', '#.....#.', '#.......', '#.......', '#...###.', '#.....#.', '#######.'],
+    'H': ['#.....#.', '#.....#.', '#.....#.', '#######.', '#.....#.', '#.....#.', '#.....#.'],
+    'I': ['...#....', '...#....', '...#....', '...#....', '...#....', '...#....', '...#....'],
+    'J': ['#######.', '...#....', '...#....', '...#....', '...#....', '#..#....', '.##.....'],
+    'K': ['.#....#.', '.#...#..', '.#..#...', '.###....', '.#..#...', '.#...#..', '.#....#.'],
+    'L': ['#.......', '#.......', '#.......', '#.......', '#.......', '#.......', '#######.'],
+    'M': ['#.....#.', '##...##.', '#.#.#.#.', '#..#..#.', '#.....#.', '#.....#.', '#.....#.'],
+    'N': ['#.....#.', '##....#.', '#.#...#.', '#..#..#.', '#...#.#.', '#....##.', '#.....#.'],
+    'O': ['.#####..', '#.....#.', '#.....#.', '#.....#.', '#.....#.', '#.....#.', '.#####..'],
+    'P': ['######..', '#.....#.', '#.....#.', '#.....#.', '######..', '#.......', '#.......'],
+    'Q': ['.#####..', '#.....#.', '#.....#.', '#..#..#.', '#...#.#.', '#....##.', '.######.'],
+    'R': ['######..', '#.....#.', '#.....#.', '#.....#.', '######..', '#...#...', '#....#..'],
+    'S': ['.####...', '#.......', '#.......', '.####...', '.....#..', '.....#..', '#####...'],
+    'T': ['#######.', '...#....', '...#....', '...#....', '...#....', '...#....', '...#....'],
+    'U': ['#.....#.', '#.....#.', '#.....#.', '#.....#.', '#.....#.', '#.....#.', '.#####..'],
+    'V': ['#.....#.', '#.....#.', '#.....#.', '#.....#.', '.#...#..', '..#.#...', '...#....'],
+    'W': ['#.....#.', '#.....#.', '#.....#.', '#..#..#.', '#.#.#.#.', '##...##.', '#.....#.'],
+    'X': ['.#....#.', '..#..#..', '...##...', '........', '...##...', '..#..#..', '.#....#.'],
+    'Y': ['#.....#.', '.#...#..', '..#.#...', '...#....', '...#....', '...#....', '...#....'],
+    'Z': ['######..', '....#...', '...#....', '..#.....', '..#.....', '.#......', '######..'],
+    '0': ['.#####..', '#.....#.', '#.....#.', '#..#..#.', '#.....#.', '#.....#.', '.#####..'],
+    '1': ['...#....', '..##....', '...#....', '...#....', '...#....', '...#....', '..###...'],
+    '2': ['.####...', '.....#..', '.....#..', '.####...', '#.......', '#.......', '.#####..'],
+    '3': ['######..', '......#.', '......#.', '######..', '......#.', '......#.', '######..'],
+    '4': ['#.......', '#.......', '#.......', '#..#....', '#..#....', '######..', '...#....'],
+    '5': ['#####...', '#.......', '#.......', '#####...', '.....#..', '.....#..', '#####...'],
+    '6': ['#.......', '#.......', '#.......', '######..', '#.....#.', '#.....#.', '.#####..'],
+    '7': ['#######.', '......#.', '.....#..', '.....#..', '....#...', '...##...', '...#....'],
+    '8': ['.#####..', '#.....#.', '#.....#.', '.#####..', '#.....#.', '#.....#.', '.#####..'],
+    '9': ['.######.', '#.....#.', '#.....#.', '.######.', '......#.', '......#.', '......#.'],
+
+    'a': ['', '', '.####', '.....#', '.#####', '#....#', '.#####'],
+    'b': ['#', '#', '#.###', '##...#', '#....#', '##...#', '#.###'],
+    'c': ['', '', '.####', '#', '#', '#', '.####'],
+    'd': ['.....#', '.....#', '.###.#', '#...##', '#....#', '#...##', '.###.#'],
+    'e': ['', '', '.####', '#....#', '######', '#', '.####'],
+    'f': ['...##', '..#', '.####', '..#', '..#', '..#', '..#'],
+    'g': ['', '', '.#####', '#....#', '#....#', '.#####', '.....#', '.####'],
+    'h': ['#', '#', '#.###', '##...#', '#....#', '#....#', '#....#'],
+    'i': ['...#', '', '..##', '...#', '...#', '...#', '..###'],
+    'j': ['....#', '', '...##', '....#', '....#', '....#', '#...#', '.###'],
+    'k': ['#', '#', '#...#', '#..#', '###', '#..#', '#...#'],
+    'l': ['..##', '...#', '...#', '...#', '...#', '...#', '..###'],
+    'm': ['', '', '##.#', '#.#.#', '#.#.#', '#.#.#', '#.#.#'],
+    'n': ['', '', '#.###', '##...#', '#....#', '#....#', '#....#'],
+    'o': ['', '', '.####', '#....#', '#....#', '#....#', '.####'],
+    'p': ['', '', '#.###', '##...#', '#....#', '#####', '#', '#'],
+    'q': ['', '', '.###.#', '#...##', '#....#', '.#####', '.....#', '.....#'],
+    'r': ['', '', '#.###', '##', '#', '#', '#'],
+    's': ['', '', '.####', '#', '.####', '.....#', '#####'],
+    't': ['..#', '..#', '#####', '..#', '..#', '..#', '...##'],
+    'u': ['', '', '#....#', '#....#', '#....#', '#...##', '.###.#'],
+    'v': ['', '', '#....#', '#....#', '.#..#', '.#..#', '..##'],
+    'w': ['', '', '#.....#', '#.....#', '#..#..#', '#.#.#.#', '.#...#'],
+    'x': ['', '', '#...#', '.#.#', '..#', '.#.#', '#...#'],
+    'y': ['', '', '#....#', '#....#', '#....#', '.#####', '.....#', '.####'],
+    'z': ['', '', '#####', '...#', '..#', '.#', '#####'],
+
+    # Latin-1 (símbolos)
+    '¡': ['...#', '', '...#', '...#', '...#', '...#', '...#'],
+    '¢': ['...#', '.####', '#..#', '#..#', '#..#', '.####', '...#'],
+    '£': ['..###', '.#...#', '.#', '####', '.#', '.#', '######'],
+    '¤': ['', '#....#', '.####', '.#..#', '.#..#', '.####', '#....#'],
+    '¥': ['#.....#', '.#...#', '..#.#', '.#####', '...#', '.#####', '...#'],
+    '¦': ['...#', '...#', '...#', '', '...#', '...#', '...#'],
+    '§': ['.###', '#', '.##', '#..#', '.##', '...#', '###'],
+    '¨': ['.#..#'],
+    '©': ['.#####', '#.....#', '#.###.#', '#.#...#', '#.###.#', '#.....#', '.#####'],
+    'ª': ['.###', '...#', '.###', '#..#', '.###', '', '####'],
+    '«': ['', '...#..#', '..#..#', '.#..#', '..#..#', '...#..#'],
+    '¬': ['', '', '######', '.....#', '.....#'],
+    '­': ['', '', '', '..###'],
+    '®': ['.#####', '#.....#', '#.##..#', '#.#.#.#', '#.##..#', '#.#.#.#', '.#####'],
+    '¯': ['#######'],
+    '°': ['..##', '.#..#', '..##'],
+    '±': ['...#', '...#', '.#####', '...#', '...#', '', '.#####'],
+    '²': ['.##', '...#', '..#', '.###'],
+    '³': ['.##', '..##', '...#', '.##'],
+    '´': ['...#', '..#'],
+    'µ': ['', '', '#....#', '#....#', '#....#', '##...#', '#.###', '#'],
+    '¶': ['.#####', '###.#', '###.#', '.##.#', '...#.#', '...#.#', '...#.#'],
+    '·': ['', '', '', '..##', '..##'],
+    '¸': ['', '', '', '', '', '', '..#', '.#'],
+    '¹': ['..#', '.##', '..#', '.###'],
+    'º': ['.##', '#..#', '#..#', '.##', '', '####'],
+    '»': ['', '#..#', '.#..#', '..#..#', '.#..#', '#..#'],
+    '¼': ['.#....#', '##...#', '.#..#', '...#.#', '..#.##', '.#.###', '#....#'],
+    '½': ['.#....#', '##...#', '.#..#', '...#', '..#.##', '.#...#', '#...##'],
+    '¾': ['##....#', '.#...#', '##..#', '.##.#.#', '..#.##', '.#.###', '#....#'],
+    '¿': ['...#', '', '...#', '..#', '.#', '#....#', '.####'],
+    'Æ': ['..#####', '.#.#', '#..#', '######', '#..#', '#..#', '#..####'],
+    'Ð': ['######', '.#....#', '.#....#', '####..#', '.#....#', '.#....#', '######'],
+    '×': ['', '#...#', '.#.#', '..#', '.#.#', '#...#'],
+    'Ø': ['.#####.#', '#....##', '#...#.#', '#..#..#', '#.#...#', '##....#', '#.#####'],
+    'Þ': ['#', '#####', '#....#', '#....#', '#####', '#', '#'],
+    'ß': ['.###', '#...#', '#..#', '#.##', '#...#', '#...#', '#.##'],
+    'æ': ['', '', '.##.##', '...#..#', '.######', '#..#', '.##.###'],
+    'ð': ['.#.#', '..#', '.#.#', '.....#', '.#####', '#....#', '.####'],
+    '÷': ['', '...#', '', '.#####', '', '...#'],
+    'ø': ['', '', '.####.#', '#...##', '#..#.#', '##...#', '#.####'],
+    'þ': ['', '#', '#.###', '##...#', '#....#', '#####', '#', '#'],
+}
+
+# Maiúsculas reduzidas (linhas 2-6) para receber acentos sem sair das 8 linhas
+SMALL_CAPS = {
+    'A': ['', '', '..###', '.#...#', '#######', '#.....#', '#.....#'],
+    'C': ['', '', '.######', '#', '#', '#', '.######'],
+    'E': ['', '', '#######', '#', '#####', '#', '#######'],
+    'I': ['', '', '..###', '...#', '...#', '...#', '..###'],
+    'N': ['', '', '##....#', '#.#...#', '#..#..#', '#...#.#', '#....##'],
+    'O': ['', '', '.#####', '#.....#', '#.....#', '#.....#', '.#####'],
+    'U': ['', '', '#.....#', '#.....#', '#.....#', '#.....#', '.#####'],
+    'Y': ['', '', '#.....#', '.#...#', '..###', '...#', '...#'],
+}
+
+# Acentos desenhados nas linhas 0-1, centralizados sobre a letra base
+ACCENTS = {
+    'grave': ['.#', '..#'],
+    'acute': ['..#', '.#'],
+    'circumflex': ['..#', '.#.#'],
+    'tilde': ['.#.#', '#.#'],
+    'diaeresis': ['#...#'],
+    'ring': ['.#.#', '..#'],
+}
+
+# Letras acentuadas do Latin-1: código -> (letra base, acento)
+COMPOSED = {
+    0xC0: ('A', 'grave'), 0xC1: ('A', 'acute'), 0xC2: ('A', 'circumflex'), 0xC3: ('A', 'tilde'),
+    0xC4: ('A', 'diaeresis'), 0xC5: ('A', 'ring'), 0xC7: ('C', 'cedilla'),
+    0xC8: ('E', 'grave'), 0xC9: ('E', 'acute'), 0xCA: ('E', 'circumflex'), 0xCB: ('E', 'diaeresis'),
+    0xCC: ('I', 'grave'), 0xCD: ('I', 'acute'), 0xCE: ('I', 'circumflex'), 0xCF: ('I', 'diaeresis'),
+    0xD1: ('N', 'tilde'), 0xD2: ('O', 'grave'), 0xD3: ('O', 'acute'), 0xD4: ('O', 'circumflex'),
+    0xD5: ('O', 'tilde'), 0xD6: ('O', 'diaeresis'), 0xD9: ('U', 'grave'), 0xDA: ('U', 'acute'),
+    0xDB: ('U', 'circumflex'), 0xDC: ('U', 'diaeresis'), 0xDD: ('Y', 'acute'),
+    0xE0: ('a', 'grave'), 0xE1: ('a', 'acute'), 0xE2: ('a', 'circumflex'), 0xE3: ('a', 'tilde'),
+    0xE4: ('a', 'diaeresis'), 0xE5: ('a', 'ring'), 0xE7: ('c', 'cedilla'),
+    0xE8: ('e', 'grave'), 0xE9: ('e', 'acute'), 0xEA: ('e', 'circumflex'), 0xEB: ('e', 'diaeresis'),
+    0xEC: ('ı', 'grave'), 0xED: ('ı', 'acute'), 0xEE: ('ı', 'circumflex'),
+    0xEF: ('ı', 'diaeresis'), 0xF1: ('n', 'tilde'), 0xF2: ('o', 'grave'), 0xF3: ('o', 'acute'),
+    0xF4: ('o', 'circumflex'), 0xF5: ('o', 'tilde'), 0xF6: ('o', 'diaeresis'), 0xF9: ('u', 'grave'),
+    0xFA: ('u', 'acute'), 0xFB: ('u', 'circumflex'), 0xFC: ('u', 'diaeresis'), 0xFD: ('y', 'acute'),
+    0xFF: ('y', 'diaeresis'),
+}
+
+# 'i' sem pingo, base das variantes acentuadas de 'i'
+DOTLESS_I = ['', '', '..##', '...#', '...#', '...#', '..###']
+
+
+def to_grid(rows):
+    grid = [[0] * 8 for _ in range(8)]
+    for r, line in enumerate(rows):
+        for c, ch in enumerate(line[:8]):
+            grid[r][c] = 1 if ch == '#' else 0
+    return grid
+
+
+def columns(grid):
+    return [sum(grid[r][c] << r for r in range(8)) for c in range(8)]
+
+
+def composed_grid(base, accent):
+    if base == 'ı':
+        grid = to_grid(DOTLESS_I)
+    elif base in SMALL_CAPS:
+        grid = to_grid(SMALL_CAPS[base])
+    else:
+        grid = to_grid(GLYPHS[base])
+
+    if accent == 'cedilla':
+        grid[7] = [0] * 8
+        grid[7][2] = grid[7][3] = 1
+        return grid
+
+    # Centraliza o acento sobre as colunas ocupadas pela letra
+    used = [c for c in range(8) if any(grid[r][c] for r in range(8))]
+    mark = to_grid(ACCENTS[accent])
+    mark_used = [c for c in range(8) if any(mark[r][c] for r in range(2))]
+    shift = (min(used) + max(used)) // 2 - (min(mark_used) + max(mark_used)) // 2
+    for r in range(2):
+        grid[r] = [0] * 8
+        for c in mark_used:
+            if mark[r][c] and 0 <= c + shift < 8:
+                grid[r][c + shift] = 1
+    return grid
+
+
+def glyph(code):
+    if code in COMPOSED:
+        return columns(composed_grid(*COMPOSED[code])), chr(code)
+    ch = chr(code)
+    if code == 0xA0:
+        return columns(to_grid([])), 'NBSP'
+    if ch in GLYPHS:
+        return columns(to_grid(GLYPHS[ch])), ch
+    return None, None
+
+
+def render():
+    lines = [
+        '// Gerado por tools/ssd1306_font_gen.py (não editar manualmente)',
+        '// Glifos 8x8 indexados diretamente pelo código do caractere (ASCII + Latin-1): font[codigo * 8]',
+        'static const uint8_t font[256 * 8] = {',
+    ]
+    for code in range(256):
+        data, name = glyph(code)
+        if data is None:
+            data, name = [0] * 8, 'U+%04X' % code
+        elif name in ('\\',):
+            name = 'backslash'
+        lines.append('    ' + ', '.join('0x%02x' % b for b in data) + ', // ' + name)
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+if __name__ == '__main__':
+    text = render()
+    for path in sys.argv[1:]:
+        with open(path, 'w', encoding='utf-8') as f:
+            f.write(text)
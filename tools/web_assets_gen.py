@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+# Gera o cabeçalho com os arquivos estáticos de um servidor httpd a partir do diretório web/ do projeto. Cada
+# arquivo é comprimido com gzip e gravado como um vetor const (na flash XIP do RP2040, enviado ao lwIP por
+# referência); o índice fica ordenado pelo caminho para a busca binária de httpd_find_asset.
+#
+# Cache: páginas HTML são revalidadas a cada acesso (no-cache); os demais arquivos ficam no cache do navegador
+# por CACHE_MAX_AGE segundos. O ETag de cada arquivo vem do SHA-1 do conteúdo, para a revalidação responder 304.
+#
+# Usa apenas a biblioteca padrão. A saída é a mesma para a mesma entrada (o gzip é gravado sem data).
+#
+# Uso: python3 tools/web_assets_gen.py <diretório web> <saida.h>
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+CACHE_MAX_AGE = 7 * 24 * 3600
+
+CONTENT_TYPES = {
+    '.html': 'text/html; charset=UTF-8',
+    '.css': 'text/css; charset=UTF-8',
+    '.js': 'text/javascript; charset=UTF-8',
+    '.json': 'application/json',
+    '.svg': 'image/svg+xml',
+    '.png': 'image/png',
+    '.ico': 'image/x-icon',
+    '.txt': 'text/plain; charset=UTF-8',
+}
+
+# Tamanho máximo do caminho aceito pelo servidor (httpd_path_max_length, com o terminador)
+PATH_MAX_LENGTH = 32
+
+
+def collect(web_dir):
+    assets = []
+    for root, dirs, files in os.walk(web_dir):
+        dirs.sort()
+        for name in sorted(files):
+            if name.startswith('.'):
+                continue
+            full = os.path.join(root, name)
+            path = '/' + os.path.relpath(full, web_dir).replace(os.sep, '/')
+            extension = os.path.splitext(name)[1].lower()
+            if extension not in CONTENT_TYPES:
+                raise ValueError('%s: extensão sem Content-Type conhecido' % full)
+            if len(path) >= PATH_MAX_LENGTH:
+                raise ValueError('%s: caminho maior que %d caracteres' % (path, PATH_MAX_LENGTH - 1))
+            with open(full, 'rb') as f:
+                data = f.read()
+            assets.append((path, extension, data))
+    # Mesma ordem de strcmp, usada na busca binária
+    assets.sort(key=lambda asset: asset[0].encode())
+    return assets
+
+
+def identifier(path):
+    return 'web_asset_' + re.sub(r'[^0-9A-Za-z]', '_', path.strip('/'))
+
+
+def render(web_dir):
+    lines = [
+        '// Gerado por tools/web_assets_gen.py a partir de web/ (não editar manualmente)',
+        '#ifndef web_assets_h',
+        '#define web_assets_h',
+        '',
+        '#include "inc/httpd.h"',
+        '',
+    ]
+
+    index = []
+    raw_total = packed_total = 0
+    for path, extension, data in collect(web_dir):
+        packed = gzip.compress(data, compresslevel=9, mtime=0)
+        name = identifier(path)
+        cache = 'no-cache' if extension == '.html' else 'max-age=%d' % CACHE_MAX_AGE
+        etag = '\\"%s\\"' % hashlib.sha1(data).hexdigest()[:16]
+        raw_total += len(data)
+        packed_total += len(packed)
+
+        lines.append('// %s: %d bytes, %d com gzip' % (path, len(data), len(packed)))
+        lines.append('static const uint8_t %s[%d] = {' % (name, len(packed)))
+        for i in range(0, len(packed), 16):
+            lines.append('    ' + ', '.join('0x%02x' % b for b in packed[i:i + 16]) + ',')
+        lines.append('};')
+        lines.append('')
+        index.append('    {"%s", "%s", "%s", "%s", %s, sizeof(%s)},' % (path, CONTENT_TYPES[extension], cache, etag, name, name))
+
+    lines.append('// %d bytes com gzip (%d sem compressão), ordenados pelo caminho' % (packed_total, raw_total))
+    lines.append('static const struct httpd_asset web_asset_list[] = {')
+    lines += index
+    lines.append('};')
+    lines.append('')
+    lines.append('static const struct httpd_asset_store web_assets = httpd_asset_store(web_asset_list);')
+    lines.append('')
+    lines.append('#endif')
+    return '\n'.join(lines) + '\n'
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit('uso: %s <diretório web> <saida.h>' % sys.argv[0])
+    text = render(sys.argv[1])
+    with open(sys.argv[2], 'w', encoding='utf-8') as f:
+        f.write(text)